@@ -63,6 +63,7 @@ namespace Netvisix {
                     hostInactiveColor               = QColor(160, 160, 160, 255);
                     hostOutlineColor                = QColor(140, 140, 140, 255);
                     hostLocalInterfaceMarkerColor   = QColor(190, 190, 190, 255);
+                    hostAnomalyMarkerColor          = QColor(200, 40, 40, 255);
 
                     packetOutlineColor              = QColor(80, 80, 80, 255);
 
@@ -78,6 +79,7 @@ namespace Netvisix {
                     hostInactiveColor               = QColor(110, 110, 130, 0);
                     hostOutlineColor                = QColor(120, 120, 120, 255);
                     hostLocalInterfaceMarkerColor   = QColor(60, 60, 60, 255);
+                    hostAnomalyMarkerColor          = QColor(220, 60, 60, 255);
 
                     packetOutlineColor              = QColor(120, 120, 120, 255);
 
@@ -56,6 +56,7 @@ namespace Netvisix {
                 QColor hostInactiveColor;
                 QColor hostOutlineColor;
                 QColor hostLocalInterfaceMarkerColor;
+                QColor hostAnomalyMarkerColor;
 
                 QColor packetOutlineColor;
 
@@ -0,0 +1,517 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ForceLayout.h"
+#include "Net/NetEventManager.h"
+
+#include <QElapsedTimer>
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace Netvisix {
+
+    ForceLayout::ForceLayout() {
+        nodeCount = 0;
+        boundsChanged = false;
+        resetRequested = false;
+        generation = 0;
+
+        temperature = 0;
+        simGeneration = 0;
+        activeCount = 0;
+
+        frontGeneration = 0;
+        hasNewPositions = false;
+    }
+
+    ForceLayout::~ForceLayout() {
+        stop();
+    }
+
+    void ForceLayout::stop() {
+        // (the request survives until run() checks it, start() clears it again)
+        requestInterruption();
+        wait();
+    }
+
+    void ForceLayout::reset() {
+        inputMutex.lock();
+        pendingNodes.clear();
+        pendingEdges.clear();
+        pendingRemovals.clear();
+        edgeKeys.clear();
+        nodeCount = 0;
+        freeIndices.clear();
+        resetRequested = true;
+        generation++;
+        inputMutex.unlock();
+    }
+
+    int ForceLayout::addNode(NetArea netArea, QPointF pos) {
+        PendingNode node;
+        node.netArea = netArea;
+        node.pos = pos;
+
+        inputMutex.lock();
+        if (freeIndices.empty()) {
+            node.index = nodeCount++;
+        }
+        else {
+            node.index = freeIndices.back();
+            freeIndices.pop_back();
+        }
+        pendingNodes.push_back(node);
+        inputMutex.unlock();
+
+        return node.index;
+    }
+
+    void ForceLayout::removeNode(int node) {
+        if (node < 0) {
+            return;
+        }
+
+        inputMutex.lock();
+        pendingRemovals.push_back(node);
+        inputMutex.unlock();
+    }
+
+    quint64 ForceLayout::getEdgeKey(int nodeA, int nodeB) {
+        return ((quint64) std::min(nodeA, nodeB) << 32) | (quint32) std::max(nodeA, nodeB);
+    }
+
+    void ForceLayout::addEdge(int nodeA, int nodeB) {
+        if (nodeA < 0 || nodeB < 0 || nodeA == nodeB) {
+            return;
+        }
+
+        // (undirected, each conversation is one spring)
+        quint64 key = getEdgeKey(nodeA, nodeB);
+
+        inputMutex.lock();
+        if (edgeKeys.insert(key).second) {
+            pendingEdges.push_back(std::make_pair(nodeA, nodeB));
+        }
+        inputMutex.unlock();
+    }
+
+    void ForceLayout::setBounds(QRectF viewRect, QRectF lanAreaRect) {
+        inputMutex.lock();
+        pendingViewRect = viewRect;
+        pendingLanAreaRect = lanAreaRect;
+        boundsChanged = true;
+        inputMutex.unlock();
+    }
+
+    bool ForceLayout::getPositions(std::vector<QPointF>& positions) {
+        bool result = false;
+
+        outputMutex.lock();
+        if (hasNewPositions && frontGeneration == generation) {
+            positions = frontPositions;
+            hasNewPositions = false;
+            result = true;
+        }
+        outputMutex.unlock();
+
+        return result;
+    }
+
+    bool ForceLayout::applyInput() {
+        inputMutex.lock();
+
+        bool changed = false;
+
+        if (resetRequested) {
+            posX.clear();
+            posY.clear();
+            areas.clear();
+            active.clear();
+            activeCount = 0;
+            edges.clear();
+            simGeneration = generation;
+            resetRequested = false;
+            changed = true;
+        }
+
+        if (boundsChanged) {
+            viewRect = pendingViewRect;
+            lanAreaRect = pendingLanAreaRect;
+            boundsChanged = false;
+            changed = true;
+        }
+
+        for (const PendingNode& node : pendingNodes) {
+            if (node.index >= (int) posX.size()) {
+                posX.resize(node.index + 1, 0);
+                posY.resize(node.index + 1, 0);
+                areas.resize(node.index + 1, node.netArea);
+                active.resize(node.index + 1, 0);
+            }
+            posX[node.index] = node.pos.x();
+            posY[node.index] = node.pos.y();
+            areas[node.index] = node.netArea;
+            if (! active[node.index]) {
+                active[node.index] = 1;
+                activeCount++;
+            }
+        }
+        edges.insert(edges.end(), pendingEdges.begin(), pendingEdges.end());
+
+        changed = changed || ! pendingNodes.empty() || ! pendingEdges.empty() || ! pendingRemovals.empty();
+        pendingNodes.clear();
+        pendingEdges.clear();
+
+        applyRemovals();
+
+        inputMutex.unlock();
+
+        dispX.resize(posX.size());
+        dispY.resize(posY.size());
+
+        return changed;
+    }
+
+    void ForceLayout::applyRemovals() {
+        // (input mutex is held, the indices are free for reuse afterwards)
+        if (pendingRemovals.empty()) {
+            return;
+        }
+
+        for (int node : pendingRemovals) {
+            if (node < (int) active.size() && active[node]) {
+                active[node] = 0;
+                activeCount--;
+            }
+        }
+
+        for (auto it = edges.begin(); it != edges.end();) {
+            if (! active[it->first] || ! active[it->second]) {
+                edgeKeys.erase(getEdgeKey(it->first, it->second));
+                *it = edges.back();
+                edges.pop_back();
+            }
+            else {
+                ++it;
+            }
+        }
+
+        freeIndices.insert(freeIndices.end(), pendingRemovals.begin(), pendingRemovals.end());
+        pendingRemovals.clear();
+    }
+
+    void ForceLayout::run() {
+        QElapsedTimer timer;
+        while (! isInterruptionRequested()) {
+            timer.start();
+
+            if (applyInput()) {
+                // reheat (new nodes, springs or bounds)
+                temperature = std::max(temperature, viewRect.width() * 0.05);
+            }
+
+            if (temperature > TEMPERATURE_MIN && activeCount > 0) {
+                step();
+                publishPositions();
+                temperature *= COOLING;
+
+                qint64 elapsed = timer.elapsed();
+                if (elapsed < (qint64) STEP_INTERVAL) {
+                    msleep(STEP_INTERVAL - elapsed);
+                }
+            }
+            else {
+                // converged
+                msleep(IDLE_INTERVAL);
+            }
+        }
+    }
+
+    void ForceLayout::step() {
+        int n = posX.size();
+
+        // optimal distance between nodes
+        double k = std::sqrt((viewRect.width() * viewRect.height()) / std::max(activeCount, 1)) * 0.5;
+        k = std::min(std::max(k, 15.0), 150.0);
+
+        std::fill(dispX.begin(), dispX.end(), 0.0);
+        std::fill(dispY.begin(), dispY.end(), 0.0);
+
+        // repulsion
+        buildQuadTree();
+        for (int i = 0; i < n; i++) {
+            if (active[i]) {
+                applyRepulsion(i, k);
+            }
+        }
+
+        // springs
+        for (const std::pair<int, int>& edge : edges) {
+            int a = edge.first;
+            int b = edge.second;
+            if (a >= n || b >= n) {
+                continue;
+            }
+
+            double dx = posX[a] - posX[b];
+            double dy = posY[a] - posY[b];
+            double d = std::max(std::sqrt(dx * dx + dy * dy), 0.01);
+            double force = (d * d) / k;
+
+            dispX[a] -= dx / d * force;
+            dispY[a] -= dy / d * force;
+            dispX[b] += dx / d * force;
+            dispY[b] += dy / d * force;
+        }
+
+        // gravity (towards the lan area center), limited by the current temperature
+        QPointF center = lanAreaRect.center();
+        for (int i = 0; i < n; i++) {
+            if (! active[i]) {
+                continue;
+            }
+
+            double dx = center.x() - posX[i];
+            double dy = center.y() - posY[i];
+            double d = std::sqrt(dx * dx + dy * dy);
+            if (d > 0.01) {
+                double gravity = 0.05 * d;
+                dispX[i] += dx / d * gravity;
+                dispY[i] += dy / d * gravity;
+            }
+
+            double length = std::sqrt(dispX[i] * dispX[i] + dispY[i] * dispY[i]);
+            if (length > 0.01) {
+                double move = std::min(length, temperature);
+                posX[i] += dispX[i] / length * move;
+                posY[i] += dispY[i] / length * move;
+            }
+
+            applyConstraints(i);
+        }
+    }
+
+    void ForceLayout::buildQuadTree() {
+        double minX = viewRect.right(), maxX = viewRect.left();
+        double minY = viewRect.bottom(), maxY = viewRect.top();
+        for (unsigned int i = 0; i < posX.size(); i++) {
+            if (! active[i]) {
+                continue;
+            }
+            minX = std::min(minX, posX[i]);
+            maxX = std::max(maxX, posX[i]);
+            minY = std::min(minY, posY[i]);
+            maxY = std::max(maxY, posY[i]);
+        }
+
+        QuadNode root;
+        root.centerX = (minX + maxX) * 0.5;
+        root.centerY = (minY + maxY) * 0.5;
+        root.halfSize = std::max(maxX - minX, maxY - minY) * 0.5 + 1.0;
+        root.comX = 0;
+        root.comY = 0;
+        root.mass = 0;
+        root.firstChild = -1;
+        root.body = -1;
+
+        quadTree.clear();
+        quadTree.push_back(root);
+
+        for (unsigned int i = 0; i < posX.size(); i++) {
+            if (active[i]) {
+                insertBody(i);
+            }
+        }
+    }
+
+    int ForceLayout::getQuadrant(const QuadNode& node, double x, double y) {
+        return (x >= node.centerX ? 1 : 0) + (y >= node.centerY ? 2 : 0);
+    }
+
+    void ForceLayout::subdivide(int nodeIndex) {
+        int firstChild = quadTree.size();
+
+        for (int q = 0; q < 4; q++) {
+            const QuadNode& parent = quadTree[nodeIndex];
+            double half = parent.halfSize * 0.5;
+
+            QuadNode child;
+            child.centerX = parent.centerX + ((q & 1) ? half : -half);
+            child.centerY = parent.centerY + ((q & 2) ? half : -half);
+            child.halfSize = half;
+            child.comX = 0;
+            child.comY = 0;
+            child.mass = 0;
+            child.firstChild = -1;
+            child.body = -1;
+            quadTree.push_back(child);
+        }
+
+        // move the existing body down
+        QuadNode& node = quadTree[nodeIndex];
+        QuadNode& child = quadTree[firstChild + getQuadrant(node, node.comX, node.comY)];
+        child.body = node.body;
+        child.mass = node.mass;
+        child.comX = node.comX;
+        child.comY = node.comY;
+
+        node.body = -1;
+        node.firstChild = firstChild;
+    }
+
+    void ForceLayout::insertBody(int body) {
+        double x = posX[body];
+        double y = posY[body];
+
+        int nodeIndex = 0;
+        while (true) {
+            QuadNode* node = &quadTree[nodeIndex];
+
+            // empty leaf
+            if (node->mass == 0) {
+                node->body = body;
+                node->mass = 1;
+                node->comX = x;
+                node->comY = y;
+                return;
+            }
+
+            if (node->firstChild < 0) {
+                if (node->halfSize < MIN_QUAD_SIZE) {
+                    // (coincident bodies, aggregate them in this leaf)
+                    node->comX = (node->comX * node->mass + x) / (node->mass + 1);
+                    node->comY = (node->comY * node->mass + y) / (node->mass + 1);
+                    node->mass += 1;
+                    node->body = -1;
+                    return;
+                }
+
+                subdivide(nodeIndex);
+                node = &quadTree[nodeIndex];
+            }
+
+            node->comX = (node->comX * node->mass + x) / (node->mass + 1);
+            node->comY = (node->comY * node->mass + y) / (node->mass + 1);
+            node->mass += 1;
+
+            nodeIndex = node->firstChild + getQuadrant(*node, x, y);
+        }
+    }
+
+    void ForceLayout::applyRepulsion(int body, double k) {
+        double x = posX[body];
+        double y = posY[body];
+        double k2 = k * k;
+
+        traversalStack.clear();
+        traversalStack.push_back(0);
+
+        while (! traversalStack.empty()) {
+            const QuadNode& node = quadTree[traversalStack.back()];
+            traversalStack.pop_back();
+
+            if (node.mass == 0 || node.body == body) {
+                continue;
+            }
+
+            double dx = x - node.comX;
+            double dy = y - node.comY;
+            double d2 = dx * dx + dy * dy;
+            double size = node.halfSize * 2;
+
+            if (node.firstChild >= 0 && size * size >= THETA * THETA * d2) {
+                // too close for the approximation, open the cell
+                for (int q = 0; q < 4; q++) {
+                    traversalStack.push_back(node.firstChild + q);
+                }
+                continue;
+            }
+
+            if (d2 < 0.0001) {
+                // (overlapping, push apart in a body dependent direction)
+                dx = std::cos(body);
+                dy = std::sin(body);
+                d2 = 1.0;
+            }
+
+            double d = std::sqrt(d2);
+            double force = k2 * node.mass / d;
+            dispX[body] += dx / d * force;
+            dispY[body] += dy / d * force;
+        }
+    }
+
+    void ForceLayout::applyConstraints(int body) {
+        NetArea netArea = areas[body];
+        QPointF center = lanAreaRect.center();
+        double radiusX = lanAreaRect.width() * 0.5;
+        double radiusY = lanAreaRect.height() * 0.5;
+        if (radiusX < 1.0 || radiusY < 1.0) {
+            return;
+        }
+
+        if (netArea == NetArea::LOCAL_INTERFACE) {
+            posX[body] = center.x();
+            posY[body] = center.y();
+            return;
+        }
+
+        // normalized distance to the lan area ellipse (1 = on the outline)
+        double ex = (posX[body] - center.x()) / radiusX;
+        double ey = (posY[body] - center.y()) / radiusY;
+        double e = std::sqrt(ex * ex + ey * ey);
+        if (e < 0.0001) {
+            ex = std::cos(body);
+            ey = std::sin(body);
+            e = 1.0;
+        }
+
+        double limit = 0;
+        if (netArea == NetArea::SUBNET) {
+            limit = std::min(e, 0.9);
+        }
+        else {
+            limit = std::max(e, 1.1);
+        }
+
+        posX[body] = center.x() + ex / e * limit * radiusX;
+        posY[body] = center.y() + ey / e * limit * radiusY;
+
+        // stay inside the view
+        const double margin = 15.0;
+        posX[body] = std::min(std::max(posX[body], viewRect.left() + margin), viewRect.right() - margin);
+        posY[body] = std::min(std::max(posY[body], viewRect.top() + margin), viewRect.bottom() - margin);
+    }
+
+    void ForceLayout::publishPositions() {
+        backPositions.resize(posX.size());
+        for (unsigned int i = 0; i < posX.size(); i++) {
+            backPositions[i] = QPointF(posX[i], posY[i]);
+        }
+
+        outputMutex.lock();
+        std::swap(backPositions, frontPositions);
+        frontGeneration = simGeneration;
+        hasNewPositions = true;
+        outputMutex.unlock();
+    }
+
+} // namespace Netvisix
@@ -0,0 +1,134 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FORCELAYOUT_H
+#define FORCELAYOUT_H
+
+#include <QThread>
+#include <QRectF>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+
+namespace Netvisix {
+
+    enum class NetArea;
+
+    // force-directed host layout (barnes-hut repulsion, conversations as springs)
+    // the simulation runs on its own thread, the gui thread only reads the published positions
+    class ForceLayout : public QThread {
+
+        public:
+            ForceLayout();
+            virtual ~ForceLayout();
+
+            void stop();
+            void reset();
+
+            int addNode(NetArea netArea, QPointF pos);
+            void removeNode(int node);
+            void addEdge(int nodeA, int nodeB);
+            void setBounds(QRectF viewRect, QRectF lanAreaRect);
+
+            bool getPositions(std::vector<QPointF>& positions);
+
+        private:
+            struct PendingNode {
+                int index;
+                NetArea netArea;
+                QPointF pos;
+            };
+
+            struct QuadNode {
+                double centerX;
+                double centerY;
+                double halfSize;
+                double comX;
+                double comY;
+                double mass;
+                int firstChild;
+                int body;
+            };
+
+            void run();
+
+            bool applyInput();
+            void applyRemovals();
+            static quint64 getEdgeKey(int nodeA, int nodeB);
+            void step();
+            void publishPositions();
+
+            void buildQuadTree();
+            void insertBody(int body);
+            void subdivide(int nodeIndex);
+            int getQuadrant(const QuadNode& node, double x, double y);
+            void applyRepulsion(int body, double k);
+            void applyConstraints(int body);
+
+            // input (gui / capture thread)
+            std::mutex inputMutex;
+            std::vector<PendingNode> pendingNodes;
+            std::vector<std::pair<int, int>> pendingEdges;
+            std::vector<int> pendingRemovals;
+            std::unordered_set<quint64> edgeKeys;
+            int nodeCount;
+            // (indices of removed nodes, reused by addNode)
+            std::vector<int> freeIndices;
+            QRectF pendingViewRect;
+            QRectF pendingLanAreaRect;
+            bool boundsChanged;
+            bool resetRequested;
+            std::atomic<quint64> generation;
+
+            // simulation (worker thread)
+            std::vector<double> posX;
+            std::vector<double> posY;
+            std::vector<double> dispX;
+            std::vector<double> dispY;
+            std::vector<NetArea> areas;
+            std::vector<quint8> active;
+            int activeCount;
+            std::vector<std::pair<int, int>> edges;
+            std::vector<QuadNode> quadTree;
+            std::vector<int> traversalStack;
+            QRectF viewRect;
+            QRectF lanAreaRect;
+            double temperature;
+            quint64 simGeneration;
+
+            // output (double buffered)
+            std::mutex outputMutex;
+            std::vector<QPointF> backPositions;
+            std::vector<QPointF> frontPositions;
+            quint64 frontGeneration;
+            bool hasNewPositions;
+
+            const double THETA = 0.8;
+            const double COOLING = 0.97;
+            const double TEMPERATURE_MIN = 0.5;
+            const double MIN_QUAD_SIZE = 0.01;
+            const unsigned long STEP_INTERVAL = 16;
+            const unsigned long IDLE_INTERVAL = 100;
+    };
+
+} // namespace Netvisix
+#endif // FORCELAYOUT_H
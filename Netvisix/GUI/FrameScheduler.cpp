@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FrameScheduler.h"
+
+#include <algorithm>
+
+
+namespace Netvisix {
+
+    FrameScheduler::FrameScheduler(int targetFPS) {
+        setTargetFPS(targetFPS);
+
+        paintTime = 0;
+
+        frameTimes = std::vector<float>(FRAME_TIMES_MAX, 0.0f);
+        frameTimesIndex = 0;
+        frameTimesCount = 0;
+
+        renderQuality = RenderQuality::High;
+        framesOverBudget = 0;
+        framesUnderBudget = 0;
+    }
+
+    FrameScheduler::~FrameScheduler() {
+    }
+
+    void FrameScheduler::setTargetFPS(int targetFPS) {
+        this->targetFPS = std::min(std::max(targetFPS, 1), 1000);
+    }
+
+    int FrameScheduler::getFrameInterval() {
+        return 1000 / targetFPS;
+    }
+
+    void FrameScheduler::beginFrame() {
+        frameTimer.start();
+    }
+
+    void FrameScheduler::endFrame() {
+        // (update time of this frame + paint time since the last frame)
+        float frameTime = (frameTimer.nsecsElapsed() + paintTime) / 1000000.0f;
+        paintTime = 0;
+
+        frameTimes[frameTimesIndex] = frameTime;
+        frameTimesIndex = (frameTimesIndex + 1) % FRAME_TIMES_MAX;
+        frameTimesCount = std::min(frameTimesCount + 1, FRAME_TIMES_MAX);
+
+        float budget = 1000.0f / targetFPS;
+        if (frameTime > budget) {
+            framesOverBudget++;
+            framesUnderBudget = 0;
+        }
+        else if (frameTime < budget * 0.5f) {
+            framesUnderBudget++;
+            framesOverBudget = 0;
+        }
+
+        updateRenderQuality();
+    }
+
+    void FrameScheduler::updateRenderQuality() {
+        if (framesOverBudget >= DOWNGRADE_FRAMES) {
+            if (renderQuality == RenderQuality::High) {
+                renderQuality = RenderQuality::Medium;
+            }
+            else {
+                renderQuality = RenderQuality::Low;
+            }
+            framesOverBudget = 0;
+        }
+        else if (framesUnderBudget >= UPGRADE_FRAMES) {
+            if (renderQuality == RenderQuality::Low) {
+                renderQuality = RenderQuality::Medium;
+            }
+            else {
+                renderQuality = RenderQuality::High;
+            }
+            framesUnderBudget = 0;
+        }
+    }
+
+    float FrameScheduler::getFrameTimePercentile(float percentile) {
+        if (frameTimesCount == 0) {
+            return 0;
+        }
+
+        std::vector<float> sorted(frameTimes.begin(), frameTimes.begin() + frameTimesCount);
+        unsigned int index = std::min((unsigned int) (percentile / 100.0f * frameTimesCount), frameTimesCount - 1);
+        std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+
+        return sorted[index];
+    }
+
+} // namespace Netvisix
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+#include <QElapsedTimer>
+
+#include <vector>
+
+
+namespace Netvisix {
+
+    enum class RenderQuality {
+        Low,        // no antialiasing, no multicast rings, limited packet count
+        Medium,     // no antialiasing, no multicast rings
+        High
+    };
+
+    // paces the main loop and lowers the render quality when the frame budget is exceeded
+    class FrameScheduler {
+
+        public:
+            FrameScheduler(int targetFPS);
+            virtual ~FrameScheduler();
+
+            void setTargetFPS(int targetFPS);
+            int getTargetFPS() { return this->targetFPS; }
+            int getFrameInterval();
+
+            void beginFrame();
+            void endFrame();
+            void addPaintTime(qint64 nsecs) { this->paintTime += nsecs; }
+
+            RenderQuality getRenderQuality() { return this->renderQuality; }
+
+            float getFrameTimePercentile(float percentile);
+
+        private:
+            void updateRenderQuality();
+
+            int targetFPS;
+
+            QElapsedTimer frameTimer;
+            qint64 paintTime;
+
+            // (frame costs in ms, ring buffer)
+            std::vector<float> frameTimes;
+            unsigned int frameTimesIndex;
+            unsigned int frameTimesCount;
+
+            RenderQuality renderQuality;
+            unsigned int framesOverBudget;
+            unsigned int framesUnderBudget;
+
+            const unsigned int FRAME_TIMES_MAX = 240;
+            const unsigned int DOWNGRADE_FRAMES = 30;
+            const unsigned int UPGRADE_FRAMES = 240;
+    };
+
+} // namespace Netvisix
+#endif // FRAMESCHEDULER_H
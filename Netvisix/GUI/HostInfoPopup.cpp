@@ -24,7 +24,9 @@
 #include "ui_MainWindow.h"
 #include "Net/Host.h"
 #include "Net/NetUtil.h"
+#include "Net/NetEvent.h"
 #include "Net/NetEventManager.h"
+#include "Net/AnomalyDetector.h"
 #include "GUI/VisibleHost.h"
 #include "GUI/StatisticPopup.h"
 
@@ -46,7 +48,7 @@ namespace Netvisix {
 
         timer = new QTimer();
         QObject::connect(timer, SIGNAL(timeout()), this, SLOT(updateLoop()));
-        timer->start();
+        timer->start(UPDATE_INTERVAL);
 
         setAttribute(Qt::WA_DeleteOnClose);
 
@@ -60,6 +62,24 @@ namespace Netvisix {
         if (host->getAddrHW() != NetUtil::zeroAddrHW) {
             addrCount++;
         }
+        if (host->getVlanID() != 0) {
+            addrCount++;
+        }
+        if (host->getTunnel() != Tunnel::None) {
+            addrCount++;
+        }
+        std::vector<uint16_t> openPortsTCP = NetEventManager::SharedInstance()->getOpenPorts(host, false);
+        std::vector<uint16_t> openPortsUDP = NetEventManager::SharedInstance()->getOpenPorts(host, true);
+        if (openPortsTCP.empty() == false) {
+            addrCount++;
+        }
+        if (openPortsUDP.empty() == false) {
+            addrCount++;
+        }
+        uint8_t anomalies = host->getAnomalies();
+        if (anomalies != 0) {
+            addrCount++;
+        }
 
         const int spacerY = 4;
         const int heightAddition = addrCount * (ui->labelAddr->height() + spacerY) + 25;
@@ -70,26 +90,63 @@ namespace Netvisix {
             if (host->getHostnameIsFromReverseDNSLookp()) {
                 hostname = "(rDNS) " + hostname;
             }
+            else if (host->getHostnameIsFromServerName()) {
+                hostname = "(SNI/Host) " + hostname;
+            }
             ui->labelHostname->setText(hostname.c_str());
         }
-        else if (mainWindow->getUI()->widgetNetView->getReverseDNSLookupEnabled() == false) {
+        else if (host->getIsAggregate()) {
+            std::string aggregate = "<b>" + std::to_string(host->getAggregateMemberCount()) + " hosts</b> (double-click to expand)";
+            ui->labelHostname->setText(aggregate.c_str());
+        }
+        else if (NetEventManager::SharedInstance()->getReverseDNSLookupEnabled() == false) {
             ui->labelHostname->setText("(rDNS disabled!)");
         }
 
         // the addresses
         int addrLabelIndex = 0;
+        if (host->getVlanID() != 0) {
+            addAddr("VLAN", NetUtil::getVlanString(host->getVlanID()), addrLabelIndex, spacerY);
+            addrLabelIndex++;
+        }
+
+        if (host->getTunnel() != Tunnel::None) {
+            std::string tunnel = NetEvent::getTunnelString(host->getTunnel(), host->getTunnelID());
+            if (host->getTunnelEndpoint().empty() == false) {
+                tunnel += " via " + host->getTunnelEndpoint();
+            }
+            addAddr("Tunnel", tunnel, addrLabelIndex, spacerY);
+            addrLabelIndex++;
+        }
+
         if (host->getAddrHW() != NetUtil::zeroAddrHW) {
             addAddr("HW", host->getAddrHW().to_string(), addrLabelIndex, spacerY);
             addrLabelIndex++;
         }
 
         for (const Tins::IPv4Address& ip : addrListIPv4) {
-            addAddr("IPv4", ip.to_string(), addrLabelIndex, spacerY);
+            addAddr("IPv4", ip.to_string(), addrLabelIndex, spacerY, NetEventManager::SharedInstance()->getSubnetName(ip, host->getVlanID()));
             addrLabelIndex++;
         }
 
         for (const Tins::IPv6Address& ip : addrListIPv6) {
-            addAddr("IPv6", ip.to_string(), addrLabelIndex, spacerY);
+            addAddr("IPv6", ip.to_string(), addrLabelIndex, spacerY, NetEventManager::SharedInstance()->getSubnetName(ip, host->getVlanID()));
+            addrLabelIndex++;
+        }
+
+        // open services (seen answering, no active scan)
+        if (openPortsTCP.empty() == false) {
+            addAddr("TCP", getPortsString(openPortsTCP), addrLabelIndex, spacerY);
+            addrLabelIndex++;
+        }
+
+        if (openPortsUDP.empty() == false) {
+            addAddr("UDP", getPortsString(openPortsUDP), addrLabelIndex, spacerY);
+            addrLabelIndex++;
+        }
+
+        if (anomalies != 0) {
+            addAddr("Alert", AnomalyDetector::getAnomaliesString(anomalies), addrLabelIndex, spacerY);
             addrLabelIndex++;
         }
 
@@ -134,19 +191,35 @@ namespace Netvisix {
         move(QPoint(parentWidget()->width() - width(), posY));
     }
 
-    void HostInfoPopup::addAddr(const std::string& type, const std::string& addr, int addrLabelIndex, int spacerY) {
+    void HostInfoPopup::addAddr(const std::string& type, const std::string& addr, int addrLabelIndex, int spacerY, const std::string& subnetName) {
         int posY = ui->labelAddr->pos().y() + addrLabelIndex * (ui->labelAddr->height() + spacerY);
 
         QLabel* labelType = new QLabel(type.c_str(), this);
         int typePosX = ui->labelAddr->pos().x();
         labelType->move(typePosX, posY);
 
-        QLabel* labelAddr = new QLabel(std::string("<b>" + addr + "</b>").c_str(), this);
+        std::string addrText = "<b>" + addr + "</b>";
+        if (subnetName != "") {
+            addrText += " (" + subnetName + ")";
+        }
+
+        QLabel* labelAddr = new QLabel(addrText.c_str(), this);
         labelAddr->setTextInteractionFlags(Qt::TextSelectableByMouse);
         int addrPosX = ui->labelAddrField->pos().x();
         labelAddr->move(addrPosX, posY);
     }
 
+    std::string HostInfoPopup::getPortsString(const std::vector<uint16_t>& ports) {
+        std::string portsString = "";
+        for (unsigned int i = 0; i < ports.size() && i < PORTS_SHOWN_MAX; i++) {
+            portsString += (i > 0 ? ", " : "") + std::to_string(ports[i]);
+        }
+        if (ports.size() > PORTS_SHOWN_MAX) {
+            portsString += " (+" + std::to_string(ports.size() - PORTS_SHOWN_MAX) + ")";
+        }
+        return portsString;
+    }
+
     void HostInfoPopup::paintEvent(QPaintEvent* event) {
         QPainter p(this);
         QStyleOption opt;
@@ -185,6 +258,6 @@ namespace Netvisix {
 void Netvisix::HostInfoPopup::on_buttonStatistic_clicked() {
     std::string title = host->getPreferedHostIdentifier();
 
-    StatisticPopup* statisticPopup = new StatisticPopup(host->statistic, title, mainWindow);
+    StatisticPopup* statisticPopup = new StatisticPopup(host->statistic, title, mainWindow, host);
     statisticPopup->show();
 }
@@ -52,10 +52,13 @@ namespace Netvisix {
         private:
             Q_OBJECT
 
-            void addAddr(const std::string& type, const std::string& addr, int addrLabelIndex, int spacerY);
+            void addAddr(const std::string& type, const std::string& addr, int addrLabelIndex, int spacerY, const std::string& subnetName = "");
 
             void updateCounters();
 
+            // "22, 80, 443 (+3)"
+            static std::string getPortsString(const std::vector<uint16_t>& ports);
+
             QTimer* timer;
             quint64 lastUpdateTime;
 
@@ -64,6 +67,9 @@ namespace Netvisix {
             Host* host;
 
             MainWindow* mainWindow;
+
+            const int UPDATE_INTERVAL = 100;
+            static const unsigned int PORTS_SHOWN_MAX = 10;
     };
 
 } // namespace Netvisix
@@ -22,189 +22,150 @@
 #include "ui_MainWindow.h"
 #include "Config.h"
 #include "Net/NetEventManager.h"
-#include "Net/NetEvent.h"
-#include "Net/NetUtil.h"
-#include "Net/NetStatistic.h"
+#include "Net/HostChangeTracker.h"
 #include "Net/Host.h"
 #include "GUI/HostInfoPopup.h"
-#include "GUI/VisibleHost.h"
+#include "GUI/HostTableModel.h"
 
 #include <QtWidgets>
 
+#include <algorithm>
+
 
 namespace Netvisix {
 
     HostList::HostList(MainWindow* mainWindow) {
         this->mainWindow = mainWindow;
 
-        tableWidget = new QTableWidget();
-        tableWidget->verticalHeader()->setVisible(false);
-        tableWidget->setSelectionMode(QAbstractItemView::NoSelection);
-        tableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        hostTableModel = new HostTableModel(mainWindow->getUI()->widgetNetView, this);
+        hostTableProxyModel = new HostTableProxyModel(hostTableModel, this);
+
+        tableView = new QTableView();
+        tableView->setModel(hostTableProxyModel);
+        tableView->verticalHeader()->setVisible(false);
+        tableView->setSelectionMode(QAbstractItemView::NoSelection);
+        tableView->setEditTriggers(QAbstractItemView::NoEditTriggers);
 
-        tableWidget->setColumnCount(4);
-        tableWidget->setColumnHidden(3, true);
+        // (fixed row heights, the view doesn't need to measure every row)
+        tableView->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+        tableView->verticalHeader()->setDefaultSectionSize(tableView->verticalHeader()->minimumSectionSize());
 
-        tableWidget->setMouseTracking(true);
-        connect(tableWidget, SIGNAL(cellEntered(int, int)), this, SLOT(tableCellEntered(int, int)));
+        tableView->setSortingEnabled(true);
+        tableView->sortByColumn(HostTableModel::COLUMN_FRAMES, Qt::DescendingOrder);
 
-        // table header
-        QStringList headerLables;
-        headerLables << "Host" << "Frames" << "Bytes";
-        tableWidget->setHorizontalHeaderLabels(headerLables);
+        tableView->setMouseTracking(true);
+        connect(tableView, SIGNAL(entered(const QModelIndex&)), this, SLOT(tableCellEntered(const QModelIndex&)));
+        connect(tableView, SIGNAL(doubleClicked(const QModelIndex&)), this, SLOT(tableCellDoubleClicked(const QModelIndex&)));
 
         const int width = mainWindow->getUI()->widgetHostList->width() - 40;
-        QHeaderView* header = tableWidget->horizontalHeader();
+        QHeaderView* header = tableView->horizontalHeader();
         header->resizeSection(0, width * 0.5f);
         header->resizeSection(1, width * 0.25f);
         header->resizeSection(2, width * 0.25f);
 
         mainWindow->getUI()->widgetHostList->setLayout(new QVBoxLayout());
-        mainWindow->getUI()->widgetHostList->layout()->addWidget(tableWidget);
+        mainWindow->getUI()->widgetHostList->layout()->addWidget(tableView);
 
-        NetEventManager::SharedInstance()->addPreparedNetEventListener(this);
+        hostChangeTracker = NetEventManager::SharedInstance()->createHostChangeTracker();
+        NetEventManager::SharedInstance()->addHostRemovalListener(this);
 
         hostInfoPopup = nullptr;
 
         cbShowAll = mainWindow->getUI()->widgetHostListControls->findChild<QCheckBox*>("cbShowAll");
+        lePortFilter = mainWindow->getUI()->widgetHostListControls->findChild<QLineEdit*>("lePortFilter");
 
         lastUpdateTime = 0;
 
         QTimer* timer = new QTimer();
         QObject::connect(timer, SIGNAL(timeout()), this, SLOT(updateLoop()));
-        timer->start();
+        timer->start(UPDATE_INTERVAL);
 
-        newHosts        = std::vector<Host*>();
-        hostsToUpdate   = std::set<Host*>();
+        newHosts    = std::vector<Host*>();
+        dirtyHosts  = std::vector<Host*>();
     }
 
     HostList::~HostList() {
     }
 
-    void HostList::onPreparedNetEventNewHost(Host* newHost) {
-        newHosts.push_back(newHost);
-    }
-
-    void HostList::onPreparedNetEventNewUnicastPacket(Host* sender, Host* receiver, NetEvent* netEvent) {
-        hostsToUpdate.insert(sender);
-        hostsToUpdate.insert(receiver);
-    }
+    void HostList::onHostsRemoved(const std::vector<Host*>& hosts) {
+        if (hostInfoPopup != nullptr && std::find(hosts.begin(), hosts.end(), hostInfoPopup->getHost()) != hosts.end()) {
+            hostInfoPopup->close();
+            hostInfoPopup = nullptr;
+        }
 
-    void HostList::onPreparedNetEventNewMulticastPacket(Host* sender, NetEvent* netEvent) {
-        hostsToUpdate.insert(sender);
+        // (not yet drained hosts are dropped by the tracker itself)
+        hostTableModel->removeHosts(hosts);
     }
 
-    void HostList::onHostAddrUpdate(Host* host) {
-        hostsToUpdate.insert(host);
+    size_t HostList::getMemoryUsage() {
+        return hostTableModel->getMemoryUsage();
     }
 
     void HostList::reset() {
-        tableWidget->setRowCount(0);
-    }
-
-    Host* HostList::getHostPointer(int row) {
-        QTableWidgetItem* item = tableWidget->item(row, 3);
-        qulonglong hostPointer = item->data(Qt::UserRole).toULongLong();
-        Host* host = reinterpret_cast<Host*>(hostPointer);
-        return host;
+        hostTableModel->clear();
     }
 
     void HostList::addNewHostListItems() {
-        for (auto it = newHosts.begin(); it != newHosts.end();) {
-            tableWidget->insertRow(tableWidget->rowCount());
-            int index = tableWidget->rowCount() - 1;
-
-            QTableWidgetItem* item = new QTableWidgetItem();
-            qulonglong hostPointer = reinterpret_cast<qulonglong>(*it);
-            item->setData(Qt::UserRole, hostPointer);
-            tableWidget->setItem(index, 3, item);
-
-            updateHostListItem(index, true);
-
-            it = newHosts.erase(it);
-        }
+        hostChangeTracker->getNewHosts(newHosts);
+        hostTableModel->addHosts(newHosts);
+        newHosts.clear();
     }
 
-    void HostList::updateHostListItem(int row, bool force) {
-        Host* host = getHostPointer(row);
+    void HostList::updateHostListItems() {
+        hostTableProxyModel->setShowAll(cbShowAll->isChecked());
+        updatePortFilter();
 
-        bool updateAllData = true;
-        if (! force) {
-            auto hostToUpdateIt = hostsToUpdate.find(host);
-            if (hostToUpdateIt != hostsToUpdate.end()) {
-                hostsToUpdate.erase(hostToUpdateIt);
-            }
-            else {
-                updateAllData = false;
-            }
-        }
-
-        VisibleHost* vHost = mainWindow->getUI()->widgetNetView->getVisibleHost(host);
-
-        QColor bgColor = Qt::yellow;
-
-        if (! vHost->getIsAlive()) {
-            bgColor = Qt::white;
+        hostChangeTracker->getDirtyHosts(dirtyHosts);
+        hostTableModel->refreshHosts(dirtyHosts);
+        dirtyHosts.clear();
+        hostTableModel->refreshAliveStates();
+    }
 
-            if (! cbShowAll->isChecked()) {
-                tableWidget->hideRow(row);
-                return;
-            }
+    void HostList::updatePortFilter() {
+        QString filter = lePortFilter->text().trimmed().toLower();
+        bool isUDP = filter.startsWith("udp/");
+        if (isUDP || filter.startsWith("tcp/")) {
+            filter = filter.mid(4);
         }
 
-        tableWidget->showRow(row);
-
-        if (updateAllData) {
-            unsigned long long framesSnt = host->statistic->getItem(IPVersion::ALL, Protocol::EthernetII)->framesSnt;
-            unsigned long long framesRcv = host->statistic->getItem(IPVersion::ALL, Protocol::EthernetII)->framesRcv;
-
-            unsigned long long bytesSnt = host->statistic->getItem(IPVersion::ALL, Protocol::EthernetII)->bytesSnt;
-            unsigned long long bytesRcv = host->statistic->getItem(IPVersion::ALL, Protocol::EthernetII)->bytesRcv;
-
-            std::string hostname = host->getPreferedHostIdentifier();
-            const int maxChars = 22;
-            if (hostname.size() > maxChars) {
-                hostname = hostname.substr(0, maxChars) + "…";
-            }
-
-            QTableWidgetItem* itemHost = new QTableWidgetItem(hostname.c_str());
-            tableWidget->setItem(row, 0, itemHost);
-
-            QTableWidgetItem* itemPackets = new QTableWidgetItem();
-            itemPackets->setData(Qt::EditRole, framesSnt + framesRcv);
-            tableWidget->setItem(row, 1, itemPackets);
-
-            QTableWidgetItem* itemBytes = new QTableWidgetItem(QString::fromUtf8(NetUtil::getByteString(bytesSnt + bytesRcv).c_str()));
-            tableWidget->setItem(row, 2, itemBytes);
+        bool isValid = false;
+        unsigned int port = filter.toUInt(&isValid);
+        if (isValid == false || port == 0 || port > 65535) {
+            lePortFilter->setStyleSheet(filter.isEmpty() ? "" : "QLineEdit { color: rgb(180, 0, 0) }");
+            hostTableProxyModel->setHostFilter(false, std::unordered_set<Host*>());
+            return;
         }
 
-        tableWidget->item(row, 0)->setBackground(bgColor);
-        tableWidget->item(row, 1)->setBackground(bgColor);
-        tableWidget->item(row, 2)->setBackground(bgColor);
+        lePortFilter->setStyleSheet("");
+        std::vector<Host*> hosts = NetEventManager::SharedInstance()->getHostsWithOpenPort(port, isUDP);
+        hostTableProxyModel->setHostFilter(true, std::unordered_set<Host*>(hosts.begin(), hosts.end()));
     }
 
     void HostList::updateLoop() {
         addNewHostListItems();
 
         if (QDateTime::currentMSecsSinceEpoch() - lastUpdateTime >= 300) {
-            updateAllHostListItems(false);
+            updateHostListItems();
             lastUpdateTime = QDateTime::currentMSecsSinceEpoch();
         }
 
         if (hostInfoPopup != nullptr) {
-            QPoint mousePosTabelWidget = tableWidget->mapFromGlobal(QCursor::pos());
+            QPoint mousePosTableView = tableView->mapFromGlobal(QCursor::pos());
             QPoint mousePosMainWindow = mainWindow->getUI()->widgetNetView->mapFromGlobal(QCursor::pos());
-            QRect rect = tableWidget->rect();
+            QRect rect = tableView->rect();
             rect.moveLeft(-20);
-            if (! rect.contains(mousePosTabelWidget) && ! hostInfoPopup->geometry().contains(mousePosMainWindow)) {
+            if (! rect.contains(mousePosTableView) && ! hostInfoPopup->geometry().contains(mousePosMainWindow)) {
                 hostInfoPopup->close();
                 hostInfoPopup = nullptr;
             }
         }
     }
 
-    void HostList::tableCellEntered(int row, int column) {
-        Host* host = getHostPointer(row);
+    void HostList::tableCellEntered(const QModelIndex& index) {
+        Host* host = hostTableProxyModel->getHost(index);
+        if (host == nullptr) {
+            return;
+        }
 
         if (hostInfoPopup != nullptr && host != hostInfoPopup->getHost()) {
             hostInfoPopup->close();
@@ -218,11 +179,11 @@ namespace Netvisix {
         }
     }
 
-    void HostList::updateAllHostListItems(bool force) {
-        for (int i = 0; i < tableWidget->rowCount(); i++) {
-            updateHostListItem(i, force);
+    void HostList::tableCellDoubleClicked(const QModelIndex& index) {
+        // prefix drill-down
+        Host* host = hostTableProxyModel->getHost(index);
+        if (host != nullptr && host->getIsAggregate()) {
+            NetEventManager::SharedInstance()->expandAggregateHost(host);
         }
-
-        tableWidget->sortByColumn(1, Qt::DescendingOrder);
     }
-}
+} // namespace Netvisix
@@ -20,62 +20,70 @@
 #ifndef HostList_H
 #define HostList_H
 
-#include "Net/IPreparedNetEventListener.h"
+#include "Net/IHostRemovalListener.h"
 
 #include <QWidget>
-#include <QTableWidget>
+#include <QTableView>
 #include <QCheckBox>
+#include <QLineEdit>
 
-#include <set>
-#include <mutex>
+#include <vector>
 
 
 namespace Netvisix {
 
     class MainWindow;
+    class Host;
+    class HostChangeTracker;
     class HostInfoPopup;
+    class HostTableModel;
+    class HostTableProxyModel;
 
-    class HostList : public QObject, public IPreparedNetEventListener {
+    class HostList : public QObject, public IHostRemovalListener {
         Q_OBJECT
 
         public:
             explicit HostList(MainWindow* mainWindow);
             ~HostList();
 
-            virtual void onPreparedNetEventNewHost(Host* newHost);
-            virtual void onPreparedNetEventNewUnicastPacket(Host* sender, Host* receiver, NetEvent* netEvent);
-            virtual void onPreparedNetEventNewMulticastPacket(Host* sender, NetEvent* netEvent);
-            virtual void onHostAddrUpdate(Host* host);
+            virtual void onHostsRemoved(const std::vector<Host*>& hosts);
 
             void reset();
 
+            size_t getMemoryUsage();
+
         private slots:
-            void tableCellEntered(int row, int column);
+            void tableCellEntered(const QModelIndex& index);
+            void tableCellDoubleClicked(const QModelIndex& index);
             void updateLoop();
 
         private:
-            Host* getHostPointer(int row);
-
             void addNewHostListItems();
 
-            void updateAllHostListItems(bool force);
+            void updateHostListItems();
 
-            void updateHostListItem(int row, bool force);
+            // "445", "tcp/445" or "udp/53", empty for no filter
+            void updatePortFilter();
 
             MainWindow* mainWindow;
 
-            QTableWidget* tableWidget;
+            QTableView* tableView;
+            HostTableModel* hostTableModel;
+            HostTableProxyModel* hostTableProxyModel;
 
             quint64 lastUpdateTime;
 
             HostInfoPopup* hostInfoPopup;
 
             QCheckBox* cbShowAll;
+            QLineEdit* lePortFilter;
+
+            HostChangeTracker* hostChangeTracker;
 
             std::vector<Host*> newHosts;
-            std::set<Host*> hostsToUpdate;
+            std::vector<Host*> dirtyHosts;
 
-            //std::mutex mutex;
+            const int UPDATE_INTERVAL = 50;
     };
 
 } // namespace Netvisix
@@ -0,0 +1,355 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "HostTableModel.h"
+#include "Net/Host.h"
+#include "Net/NetUtil.h"
+#include "Net/NetStatistic.h"
+#include "NetView.h"
+#include "GUI/VisibleHost.h"
+
+#include <QColor>
+#include <QBrush>
+
+#include <algorithm>
+
+
+namespace Netvisix {
+
+    HostTableModel::HostTableModel(NetView* netView, QObject* parent) : QAbstractTableModel(parent) {
+        this->netView = netView;
+
+        rows                = std::vector<Row>();
+        rowIndexByHostID    = std::vector<int>();
+        aliveRows           = std::vector<int>();
+        hasFadedAliveRows   = false;
+    }
+
+    HostTableModel::~HostTableModel() {
+    }
+
+    int HostTableModel::rowCount(const QModelIndex& parent) const {
+        if (parent.isValid()) {
+            return 0;
+        }
+        return rows.size();
+    }
+
+    int HostTableModel::columnCount(const QModelIndex& parent) const {
+        if (parent.isValid()) {
+            return 0;
+        }
+        return COLUMN_COUNT;
+    }
+
+    QVariant HostTableModel::data(const QModelIndex& index, int role) const {
+        if (! index.isValid() || index.row() >= (int) rows.size()) {
+            return QVariant();
+        }
+
+        const Row& row = rows[index.row()];
+
+        if (role == Qt::DisplayRole) {
+            switch (index.column()) {
+                case COLUMN_HOST:   return row.name;
+                case COLUMN_FRAMES: return row.frames;
+                case COLUMN_BYTES:  return row.bytesString;
+            }
+        }
+        else if (role == Qt::BackgroundRole) {
+            return QBrush(row.isAlive ? Qt::yellow : Qt::white);
+        }
+
+        return QVariant();
+    }
+
+    QVariant HostTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+        if (role != Qt::DisplayRole || orientation != Qt::Horizontal) {
+            return QVariant();
+        }
+
+        switch (section) {
+            case COLUMN_HOST:   return QString("Host");
+            case COLUMN_FRAMES: return QString("Frames");
+            case COLUMN_BYTES:  return QString("Bytes");
+        }
+
+        return QVariant();
+    }
+
+    void HostTableModel::addHosts(const std::vector<Host*>& hosts) {
+        if (hosts.empty()) {
+            return;
+        }
+
+        // one insert notification for the whole batch
+        const int first = rows.size();
+        beginInsertRows(QModelIndex(), first, first + hosts.size() - 1);
+
+        for (Host* host : hosts) {
+            Row row;
+            row.host    = host;
+            row.frames  = 0;
+            row.bytes   = 0;
+            row.isAlive = false;
+            rows.push_back(row);
+
+            const int rowIndex = rows.size() - 1;
+            if (host->getID() >= rowIndexByHostID.size()) {
+                rowIndexByHostID.resize(host->getID() + 1, -1);
+            }
+            rowIndexByHostID[host->getID()] = rowIndex;
+
+            updateRow(rowIndex, true);
+        }
+
+        endInsertRows();
+
+        compactAliveRows();
+    }
+
+    void HostTableModel::refreshHosts(const std::vector<Host*>& hosts) {
+        std::vector<int> changedRows;
+        for (Host* host : hosts) {
+            int rowIndex = getRowIndex(host);
+            if (rowIndex != -1 && updateRow(rowIndex, true)) {
+                changedRows.push_back(rowIndex);
+            }
+        }
+
+        compactAliveRows();
+        emitRowsChanged(changedRows);
+    }
+
+    void HostTableModel::refreshAliveStates() {
+        // (only alive rows can fade, dead rows become alive through packets -> refreshHosts)
+        std::vector<int> changedRows;
+        for (int rowIndex : aliveRows) {
+            if (updateRow(rowIndex, false)) {
+                changedRows.push_back(rowIndex);
+            }
+        }
+
+        compactAliveRows();
+        emitRowsChanged(changedRows);
+    }
+
+    void HostTableModel::compactAliveRows() {
+        if (! hasFadedAliveRows) {
+            return;
+        }
+        aliveRows.erase(std::remove_if(aliveRows.begin(), aliveRows.end(), [this](int rowIndex) {
+            return ! rows[rowIndex].isAlive;
+        }), aliveRows.end());
+        hasFadedAliveRows = false;
+    }
+
+    void HostTableModel::removeHosts(const std::vector<Host*>& hosts) {
+        std::vector<int> removedRows;
+        for (Host* host : hosts) {
+            int rowIndex = getRowIndex(host);
+            if (rowIndex != -1) {
+                removedRows.push_back(rowIndex);
+                rowIndexByHostID[host->getID()] = -1;
+            }
+        }
+
+        if (removedRows.empty()) {
+            return;
+        }
+
+        std::sort(removedRows.begin(), removedRows.end());
+        unsigned int rangeCount = 1;
+        for (unsigned int i = 1; i < removedRows.size(); i++) {
+            if (removedRows[i - 1] != removedRows[i] - 1) {
+                rangeCount++;
+            }
+        }
+
+        if (rangeCount <= REMOVED_RANGES_MAX) {
+            // (back to front, one notification per contiguous row range, keeps the selection)
+            int last = removedRows.size() - 1;
+            for (int i = last; i >= 0; i--) {
+                if (i == 0 || removedRows[i - 1] != removedRows[i] - 1) {
+                    beginRemoveRows(QModelIndex(), removedRows[i], removedRows[last]);
+                    rows.erase(rows.begin() + removedRows[i], rows.begin() + removedRows[last] + 1);
+                    endRemoveRows();
+                    last = i - 1;
+                }
+            }
+        }
+        else {
+            // mass removal (eviction): one compaction pass
+            beginResetModel();
+            rows.erase(std::remove_if(rows.begin(), rows.end(), [this](const Row& row) {
+                return rowIndexByHostID[row.host->getID()] == -1;
+            }), rows.end());
+            endResetModel();
+        }
+
+        // rows behind the removed ones moved up
+        hasFadedAliveRows = false;
+        aliveRows.clear();
+        for (unsigned int i = 0; i < rows.size(); i++) {
+            rowIndexByHostID[rows[i].host->getID()] = i;
+            if (rows[i].isAlive) {
+                aliveRows.push_back(i);
+            }
+        }
+    }
+
+    size_t HostTableModel::getMemoryUsage() {
+        size_t memoryUsage = rows.capacity() * sizeof(Row)
+                + rowIndexByHostID.capacity() * sizeof(int)
+                + aliveRows.capacity() * sizeof(int);
+        for (const Row& row : rows) {
+            memoryUsage += (row.name.size() + row.bytesString.size()) * sizeof(QChar);
+        }
+        return memoryUsage;
+    }
+
+    void HostTableModel::clear() {
+        beginResetModel();
+        rows.clear();
+        rowIndexByHostID.clear();
+        aliveRows.clear();
+        hasFadedAliveRows = false;
+        endResetModel();
+    }
+
+    int HostTableModel::getRowIndex(Host* host) const {
+        if (host == nullptr || host->getID() >= rowIndexByHostID.size()) {
+            return -1;
+        }
+        return rowIndexByHostID[host->getID()];
+    }
+
+    bool HostTableModel::updateRow(int rowIndex, bool updateAllData) {
+        Row& row = rows[rowIndex];
+        bool changed = false;
+
+        VisibleHost* vHost = netView->getVisibleHost(row.host);
+        bool isAlive = (vHost != nullptr && vHost->getIsAlive());
+        if (isAlive != row.isAlive) {
+            row.isAlive = isAlive;
+            changed = true;
+
+            if (isAlive) {
+                aliveRows.push_back(rowIndex);
+            }
+            else {
+                hasFadedAliveRows = true;
+            }
+        }
+
+        if (updateAllData) {
+            NetStatistic::Item* item = row.host->statistic->getItem(IPVersion::ALL, Protocol::EthernetII);
+            qulonglong frames = item->framesSnt + item->framesRcv;
+            qulonglong bytes = item->bytesSnt + item->bytesRcv;
+
+            std::string hostname = row.host->getPreferedHostIdentifier();
+            if (hostname.size() > HOSTNAME_CHARS_MAX) {
+                hostname = hostname.substr(0, HOSTNAME_CHARS_MAX) + "…";
+            }
+            QString name = QString::fromUtf8(hostname.c_str());
+
+            if (frames != row.frames || bytes != row.bytes || name != row.name) {
+                row.frames      = frames;
+                row.bytes       = bytes;
+                row.name        = name;
+                row.bytesString = QString::fromUtf8(NetUtil::getByteString(bytes).c_str());
+                changed = true;
+            }
+        }
+
+        return changed;
+    }
+
+    void HostTableModel::emitRowsChanged(std::vector<int>& changedRows) {
+        if (changedRows.empty()) {
+            return;
+        }
+
+        // (one notification per contiguous row range)
+        std::sort(changedRows.begin(), changedRows.end());
+        changedRows.erase(std::unique(changedRows.begin(), changedRows.end()), changedRows.end());
+
+        size_t first = 0;
+        for (size_t i = 1; i <= changedRows.size(); i++) {
+            if (i == changedRows.size() || changedRows[i] != changedRows[i - 1] + 1) {
+                emit dataChanged(index(changedRows[first], 0), index(changedRows[i - 1], COLUMN_COUNT - 1));
+                first = i;
+            }
+        }
+    }
+
+
+    HostTableProxyModel::HostTableProxyModel(HostTableModel* hostTableModel, QObject* parent) : QSortFilterProxyModel(parent) {
+        this->hostTableModel = hostTableModel;
+        this->showAll = false;
+        this->hostFilterEnabled = false;
+
+        setSourceModel(hostTableModel);
+        setDynamicSortFilter(true);
+    }
+
+    HostTableProxyModel::~HostTableProxyModel() {
+    }
+
+    void HostTableProxyModel::setShowAll(bool showAll) {
+        if (this->showAll != showAll) {
+            this->showAll = showAll;
+            invalidateFilter();
+        }
+    }
+
+    void HostTableProxyModel::setHostFilter(bool enabled, const std::unordered_set<Host*>& hosts) {
+        if (this->hostFilterEnabled != enabled || (enabled && this->hostFilter != hosts)) {
+            this->hostFilterEnabled = enabled;
+            this->hostFilter = enabled ? hosts : std::unordered_set<Host*>();
+            invalidateFilter();
+        }
+    }
+
+    Host* HostTableProxyModel::getHost(const QModelIndex& proxyIndex) const {
+        QModelIndex sourceIndex = mapToSource(proxyIndex);
+        if (! sourceIndex.isValid()) {
+            return nullptr;
+        }
+        return hostTableModel->getHost(sourceIndex.row());
+    }
+
+    bool HostTableProxyModel::filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const {
+        const HostTableModel::Row& row = hostTableModel->getRow(sourceRow);
+        return (showAll || row.isAlive) && (hostFilterEnabled == false || hostFilter.count(row.host) > 0);
+    }
+
+    bool HostTableProxyModel::lessThan(const QModelIndex& left, const QModelIndex& right) const {
+        const HostTableModel::Row& rowLeft = hostTableModel->getRow(left.row());
+        const HostTableModel::Row& rowRight = hostTableModel->getRow(right.row());
+
+        switch (left.column()) {
+            case HostTableModel::COLUMN_HOST:   return rowLeft.name < rowRight.name;
+            case HostTableModel::COLUMN_FRAMES: return rowLeft.frames < rowRight.frames;
+            case HostTableModel::COLUMN_BYTES:  return rowLeft.bytes < rowRight.bytes;
+        }
+
+        return false;
+    }
+} // namespace Netvisix
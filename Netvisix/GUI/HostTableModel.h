@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOSTTABLEMODEL_H
+#define HOSTTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QSortFilterProxyModel>
+
+#include <vector>
+#include <unordered_set>
+
+
+namespace Netvisix {
+
+    class Host;
+    class NetView;
+
+    // host list rows (cached per row, refreshed only for dirty & alive rows)
+    class HostTableModel : public QAbstractTableModel {
+
+        public:
+            enum Column {
+                COLUMN_HOST,
+                COLUMN_FRAMES,
+                COLUMN_BYTES,
+                COLUMN_COUNT
+            };
+
+            struct Row {
+                Host* host;
+                QString name;
+                qulonglong frames;
+                qulonglong bytes;
+                QString bytesString;
+                bool isAlive;
+            };
+
+            HostTableModel(NetView* netView, QObject* parent);
+            virtual ~HostTableModel();
+
+            int rowCount(const QModelIndex& parent = QModelIndex()) const;
+            int columnCount(const QModelIndex& parent = QModelIndex()) const;
+            QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const;
+            QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+
+            void addHosts(const std::vector<Host*>& hosts);
+            void refreshHosts(const std::vector<Host*>& hosts);
+            void refreshAliveStates();
+            void removeHosts(const std::vector<Host*>& hosts);
+            void clear();
+
+            size_t getMemoryUsage();
+
+            const Row& getRow(int row) const { return this->rows.at(row); }
+            Host* getHost(int row) const { return this->rows.at(row).host; }
+
+        private:
+            int getRowIndex(Host* host) const;
+            bool updateRow(int rowIndex, bool updateAllData);
+            void emitRowsChanged(std::vector<int>& changedRows);
+            // (drops the rows that faded from aliveRows in one pass)
+            void compactAliveRows();
+
+            NetView* netView;
+
+            std::vector<Row> rows;
+            std::vector<int> rowIndexByHostID;
+            std::vector<int> aliveRows;
+            bool hasFadedAliveRows;
+
+            const unsigned int HOSTNAME_CHARS_MAX = 22;
+            // (more removed row ranges are applied with one model reset)
+            const unsigned int REMOVED_RANGES_MAX = 16;
+    };
+
+    // sorting, "show all" & host filter (re-sorts only the rows reported by dataChanged)
+    class HostTableProxyModel : public QSortFilterProxyModel {
+
+        public:
+            HostTableProxyModel(HostTableModel* hostTableModel, QObject* parent);
+            virtual ~HostTableProxyModel();
+
+            void setShowAll(bool showAll);
+            bool getShowAll() { return this->showAll; }
+
+            // only these hosts (service inventory query), off if not enabled
+            void setHostFilter(bool enabled, const std::unordered_set<Host*>& hosts);
+
+            Host* getHost(const QModelIndex& proxyIndex) const;
+
+        protected:
+            bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const;
+            bool lessThan(const QModelIndex& left, const QModelIndex& right) const;
+
+        private:
+            HostTableModel* hostTableModel;
+            bool showAll;
+
+            bool hostFilterEnabled;
+            std::unordered_set<Host*> hostFilter;
+    };
+
+} // namespace Netvisix
+#endif // HOSTTABLEMODEL_H
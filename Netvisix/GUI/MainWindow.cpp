@@ -22,17 +22,20 @@
 #include "Config.h"
 #include "Net/NetEventManager.h"
 #include "Net/NetUtil.h"
+#include "Net/ReverseDNSService.h"
 #include "GUI/StatusbarDisplay.h"
 #include "GUI/VisibleHost.h"
-#include "GUI/VisiblePacket.h"
+#include "GUI/PacketParticleSystem.h"
 #include "GUI/StartCapturePopup.h"
 #include "GUI/HostList.h"
+#include "GUI/FrameScheduler.h"
 
 #include <QDebug>
 #include <QDateTime>
 #include <QTimer>
 #include <QLabel>
 #include <QMessageBox>
+#include <QInputDialog>
 #include <QDesktopWidget>
 #include <QGraphicsPixmapItem>
 
@@ -67,10 +70,15 @@ namespace Netvisix {
         updateSniffingButton();
 
         lastTime = QDateTime::currentMSecsSinceEpoch();
+        lastEvictionTime = lastTime;
+
+        frameScheduler = new FrameScheduler(TARGET_FPS);
+        ui->widgetNetView->setFrameScheduler(frameScheduler);
 
         timer = new QTimer();
+        timer->setTimerType(Qt::PreciseTimer);
         QObject::connect(timer, SIGNAL(timeout()), this, SLOT(mainUpdate()));
-        timer->start();
+        timer->start(frameScheduler->getFrameInterval());
 
         statusbarDisplay = new StatusbarDisplay(this);
 
@@ -92,6 +100,7 @@ namespace Netvisix {
         delete statusbarDisplay;
         delete ui;
         delete timer;
+        delete frameScheduler;
     }
 
     void MainWindow::updateAllWidgetFonts() {
@@ -115,7 +124,15 @@ namespace Netvisix {
         quint64 dt = currentTime - lastTime;
         lastTime = currentTime;
 
+        frameScheduler->beginFrame();
         ui->widgetNetView->onUpdate(dt);
+        frameScheduler->endFrame();
+
+        // host eviction (the gui side memory counts against the budget too)
+        if (currentTime - lastEvictionTime >= (quint64) EVICTION_INTERVAL) {
+            NetEventManager::SharedInstance()->evictHosts(ui->widgetNetView->getMemoryUsage() + hostList->getMemoryUsage());
+            lastEvictionTime = currentTime;
+        }
 
         statusbarDisplay->updateStatusbar(dt);
     }
@@ -175,22 +192,22 @@ namespace Netvisix {
         QGraphicsScene* gScene = new QGraphicsScene(this);
 
         ui->gvColorARP->setScene(gScene);
-        ui->gvColorARP->setForegroundBrush(VisiblePacket::getPacketColor(Protocol::ARP));
+        ui->gvColorARP->setForegroundBrush(PacketParticleSystem::getPacketColor(Protocol::ARP));
 
         ui->gvColorICMP->setScene(gScene);
-        ui->gvColorICMP->setForegroundBrush(VisiblePacket::getPacketColor(Protocol::ICMP));
+        ui->gvColorICMP->setForegroundBrush(PacketParticleSystem::getPacketColor(Protocol::ICMP));
 
         ui->gvColorTCP->setScene(gScene);
-        ui->gvColorTCP->setForegroundBrush(VisiblePacket::getPacketColor(Protocol::TCP));
+        ui->gvColorTCP->setForegroundBrush(PacketParticleSystem::getPacketColor(Protocol::TCP));
 
         ui->gvColorUDP->setScene(gScene);
-        ui->gvColorUDP->setForegroundBrush(VisiblePacket::getPacketColor(Protocol::UDP));
+        ui->gvColorUDP->setForegroundBrush(PacketParticleSystem::getPacketColor(Protocol::UDP));
 
         ui->gvColorOtherL2->setScene(gScene);
-        ui->gvColorOtherL2->setForegroundBrush(VisiblePacket::getPacketColor(Protocol::OtherL2));
+        ui->gvColorOtherL2->setForegroundBrush(PacketParticleSystem::getPacketColor(Protocol::OtherL2));
 
         ui->gvColorOtherL3->setScene(gScene);
-        ui->gvColorOtherL3->setForegroundBrush(VisiblePacket::getPacketColor(Protocol::OtherL3));
+        ui->gvColorOtherL3->setForegroundBrush(PacketParticleSystem::getPacketColor(Protocol::OtherL3));
 
         // ipv6
         QGraphicsScene* gSceneIPv6Packet = new QGraphicsScene(this);
@@ -266,5 +283,76 @@ void Netvisix::MainWindow::on_actionInfo_triggered() {
 
 void Netvisix::MainWindow::on_actionReverseDNSLookup_triggered() {
     bool rDNSLookups = ui->actionReverseDNSLookup->isChecked();
-    ui->widgetNetView->setReverseDNSLookupEnabled(rDNSLookups);
+    NetEventManager::SharedInstance()->setReverseDNSLookupEnabled(rDNSLookups);
+}
+
+void Netvisix::MainWindow::on_actionForceDirectedLayout_triggered() {
+    bool forceLayout = ui->actionForceDirectedLayout->isChecked();
+    ui->widgetNetView->setForceLayoutEnabled(forceLayout);
+}
+
+void Netvisix::MainWindow::on_actionServiceColors_triggered() {
+    bool serviceColors = ui->actionServiceColors->isChecked();
+    ui->widgetNetView->setServiceColorsEnabled(serviceColors);
+}
+
+void Netvisix::MainWindow::on_actionTargetFPS_triggered() {
+    bool ok = false;
+    int targetFPS = QInputDialog::getInt(this, " ", "Target FPS:", frameScheduler->getTargetFPS(), 1, 240, 1, &ok);
+    if (ok) {
+        frameScheduler->setTargetFPS(targetFPS);
+        timer->start(frameScheduler->getFrameInterval());
+    }
+}
+
+void Netvisix::MainWindow::on_actionMemoryBudget_triggered() {
+    NetEventManager* nm = NetEventManager::SharedInstance();
+    bool ok = false;
+    int budgetMB = QInputDialog::getInt(this, " ", "Host Memory Budget (MB):", nm->getMemoryBudget() / (1024 * 1024), 16, 65536, 16, &ok);
+    if (ok) {
+        nm->setMemoryBudget((size_t) budgetMB * 1024 * 1024);
+    }
+}
+
+void Netvisix::MainWindow::on_actionHostAggregation_triggered() {
+    NetEventManager* nm = NetEventManager::SharedInstance();
+
+    QStringList items;
+    items << "Off" << "IPv4 /24, IPv6 /48" << "IPv4 /16, IPv6 /48";
+    int current = 0;
+    if (nm->getAggregationPrefixIPv4() == 24) {
+        current = 1;
+    }
+    else if (nm->getAggregationPrefixIPv4() == 16) {
+        current = 2;
+    }
+
+    bool ok = false;
+    QString item = QInputDialog::getItem(this, " ", "Aggregate outside subnet hosts by prefix:", items, current, false, &ok);
+    if (ok) {
+        int index = items.indexOf(item);
+        if (index == 0) {
+            nm->setAggregationPrefixes(0, 0);
+        }
+        else {
+            nm->setAggregationPrefixes(index == 1 ? 24 : 16, 48);
+        }
+    }
+}
+
+void Netvisix::MainWindow::on_actionReverseDNSLimits_triggered() {
+    ReverseDNSService* reverseDNSService = NetEventManager::SharedInstance()->getReverseDNSService();
+    bool ok = false;
+    int concurrency = QInputDialog::getInt(this, " ", "Concurrent Lookups:", reverseDNSService->getConcurrency(), 1, 64, 1, &ok);
+    if (ok == false) {
+        return;
+    }
+
+    int rateLimit = QInputDialog::getInt(this, " ", "Lookups per Second:", reverseDNSService->getRateLimit(), 1, 1000, 1, &ok);
+    if (ok == false) {
+        return;
+    }
+
+    reverseDNSService->setConcurrency(concurrency);
+    reverseDNSService->setRateLimit(rateLimit);
 }
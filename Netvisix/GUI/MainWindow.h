@@ -35,6 +35,7 @@ namespace Netvisix {
     class PacketHandler;
     class StatusbarDisplay;
     class HostList;
+    class FrameScheduler;
 
     class MainWindow : public QMainWindow {
 
@@ -46,6 +47,10 @@ namespace Netvisix {
 
         Ui::MainWindow* getUI() { return this->ui; }
 
+        FrameScheduler* getFrameScheduler() { return this->frameScheduler; }
+
+        HostList* getHostList() { return this->hostList; }
+
         void showInfoPopup(std::string text);
         void showQuitPopup();
         void showStopSniffingPopup();
@@ -69,6 +74,12 @@ namespace Netvisix {
          void on_actionInfo_triggered();
 
          void on_actionReverseDNSLookup_triggered();
+         void on_actionReverseDNSLimits_triggered();
+         void on_actionForceDirectedLayout_triggered();
+         void on_actionServiceColors_triggered();
+         void on_actionTargetFPS_triggered();
+         void on_actionMemoryBudget_triggered();
+         void on_actionHostAggregation_triggered();
 
     private:
         Q_OBJECT
@@ -85,7 +96,10 @@ namespace Netvisix {
 
         QTimer* timer;
 
+        FrameScheduler* frameScheduler;
+
         quint64 lastTime;
+        quint64 lastEvictionTime;
 
         StatusbarDisplay* statusbarDisplay;
 
@@ -94,6 +108,9 @@ namespace Netvisix {
         HostList* hostList;
         float widgetHostListWidth;
 
+        const int TARGET_FPS = 60;
+        const int EVICTION_INTERVAL = 1000;
+
 #ifdef Q_OS_WIN
         const float FONT_SIZE = 8;
 #else
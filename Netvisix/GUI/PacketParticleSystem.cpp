@@ -0,0 +1,359 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PacketParticleSystem.h"
+#include "VisibleHost.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace Netvisix {
+
+    PacketParticleSystem::PacketParticleSystem() {
+        brushIPv6 = QBrush(Qt::black, Qt::BrushStyle::SolidPattern);
+        maxParticles = 0;
+    }
+
+    PacketParticleSystem::~PacketParticleSystem() {
+    }
+
+    QColor PacketParticleSystem::getPacketColor(Protocol protocol) {
+        switch (protocol) {
+            case Protocol::EthernetII:
+                return Qt::white;
+            case Protocol::LinuxSLL:
+                return Qt::white;
+            case Protocol::Loopback:
+                return Qt::white;
+            case Protocol::RawIP:
+                return Qt::white;
+            case Protocol::IPv4:
+                return Qt::white;
+            case Protocol::IPv6:
+                return Qt::white;
+
+            case Protocol::OtherL2:
+                return QColor(240, 240, 240, 255);
+            case Protocol::OtherL3:
+                return Qt::white;
+
+            case Protocol::ARP:
+                return Qt::black;
+            case Protocol::ICMP:
+                return QColor(210, 210, 0, 255);
+            case Protocol::ICMPv6:
+                return QColor(210, 210, 0, 255);
+
+            case Protocol::TCP:
+                return QColor(0, 100, 200, 255);
+            case Protocol::UDP:
+                return QColor(20, 120, 20, 255);
+
+            default:
+                return Qt::white;
+        }
+    }
+
+    QColor PacketParticleSystem::getServiceColor(Service service) {
+        switch (service) {
+            case Service::HTTP:
+                return QColor(0, 170, 255, 255);
+            case Service::TLS:
+                return QColor(0, 60, 160, 255);
+            case Service::QUIC:
+                return QColor(0, 160, 120, 255);
+            case Service::SSH:
+                return QColor(140, 0, 200, 255);
+            case Service::Telnet:
+                return QColor(200, 0, 120, 255);
+            case Service::FTP:
+                return QColor(170, 90, 0, 255);
+            case Service::Mail:
+                return QColor(230, 130, 0, 255);
+            case Service::DNS:
+                return QColor(120, 200, 40, 255);
+            case Service::DHCP:
+                return QColor(60, 160, 60, 255);
+            case Service::NTP:
+                return QColor(150, 150, 150, 255);
+            case Service::SMB:
+                return QColor(200, 60, 0, 255);
+            case Service::LDAP:
+                return QColor(120, 80, 40, 255);
+            case Service::RDP:
+                return QColor(220, 0, 0, 255);
+            case Service::Database:
+                return QColor(250, 90, 160, 255);
+            case Service::SNMP:
+                return QColor(100, 100, 60, 255);
+            case Service::VPN:
+                return QColor(40, 40, 40, 255);
+            case Service::VoIP:
+                return QColor(0, 200, 200, 255);
+
+            default:
+                return Qt::white;
+        }
+    }
+
+    QColor PacketParticleSystem::getBrushColor(unsigned int colorIndex) {
+        if (colorIndex < SERVICE_COLOR_OFFSET) {
+            return getPacketColor((Protocol) colorIndex);
+        }
+        else {
+            return getServiceColor((Service) (colorIndex - SERVICE_COLOR_OFFSET));
+        }
+    }
+
+    void PacketParticleSystem::addToBuffer(VisibleHost* sender, VisibleHost* receiver, Protocol protocol, Service service, bool isIPv6) {
+        BufferedPacket packet;
+        packet.key.sender = sender;
+        packet.key.receiver = receiver;
+        packet.key.protocol = protocol;
+        packet.key.service = service;
+        packet.isIPv6 = isIPv6;
+        packet.equalPackets = 0;
+
+        auto it = bufferIndex.find(packet.key);
+        if (it != bufferIndex.end()) {
+            buffer[it->second].equalPackets++;
+            return;
+        }
+
+        bufferIndex[packet.key] = buffer.size();
+        buffer.push_back(packet);
+    }
+
+    void PacketParticleSystem::releaseBuffer(std::vector<std::pair<VisibleHost*, VisibleHost*>>& conversations) {
+        for (const BufferedPacket& packet : buffer) {
+            addParticle(packet);
+            conversations.push_back(std::make_pair(packet.key.sender, packet.key.receiver));
+        }
+
+        buffer.clear();
+        bufferIndex.clear();
+    }
+
+    void PacketParticleSystem::addParticle(const BufferedPacket& packet) {
+        if (maxParticles > 0 && posX.size() >= maxParticles) {
+            return;
+        }
+
+        QPointF pos = packet.key.sender->getPosition();
+        QPointF target = packet.key.receiver->getPosition();
+
+        float dx = target.x() - pos.x();
+        float dy = target.y() - pos.y();
+        float length = std::sqrt(dx * dx + dy * dy);
+        if (length > 0) {
+            dx /= length;
+            dy /= length;
+        }
+
+        unsigned int color = (unsigned int) packet.key.protocol;
+        if (packet.key.service != Service::None) {
+            color = SERVICE_COLOR_OFFSET + (unsigned int) packet.key.service;
+        }
+        if (color >= brushes.size()) {
+            unsigned int oldSize = brushes.size();
+            brushes.resize(color + 1);
+            for (unsigned int i = oldSize; i < brushes.size(); i++) {
+                brushes[i] = QBrush(getBrushColor(i), Qt::BrushStyle::SolidPattern);
+            }
+        }
+
+        posX.push_back(pos.x());
+        posY.push_back(pos.y());
+        targetX.push_back(target.x());
+        targetY.push_back(target.y());
+        dirX.push_back(dx);
+        dirY.push_back(dy);
+        arrived.push_back(0);
+        colorIndex.push_back(color);
+        isIPv6.push_back(packet.isIPv6 ? 1 : 0);
+        equalPackets.push_back(std::min(packet.equalPackets, 2u));
+        receivers.push_back(packet.key.receiver);
+    }
+
+    void PacketParticleSystem::removeParticle(unsigned int index) {
+        // (swap and pop)
+        unsigned int last = posX.size() - 1;
+        if (index != last) {
+            posX[index] = posX[last];
+            posY[index] = posY[last];
+            targetX[index] = targetX[last];
+            targetY[index] = targetY[last];
+            dirX[index] = dirX[last];
+            dirY[index] = dirY[last];
+            arrived[index] = arrived[last];
+            colorIndex[index] = colorIndex[last];
+            isIPv6[index] = isIPv6[last];
+            equalPackets[index] = equalPackets[last];
+            receivers[index] = receivers[last];
+        }
+
+        posX.pop_back();
+        posY.pop_back();
+        targetX.pop_back();
+        targetY.pop_back();
+        dirX.pop_back();
+        dirY.pop_back();
+        arrived.pop_back();
+        colorIndex.pop_back();
+        isIPv6.pop_back();
+        equalPackets.pop_back();
+        receivers.pop_back();
+    }
+
+    void PacketParticleSystem::update(quint64 dt) {
+        const unsigned int count = posX.size();
+
+        // the particles follow their (moving) receivers
+        for (unsigned int i = 0; i < count; i++) {
+            QPointF target = receivers[i]->getPosition();
+            targetX[i] = target.x();
+            targetY[i] = target.y();
+        }
+
+        // (branch free, so the compiler can vectorize it)
+        const float step = SPEED * dt;
+        float* px = posX.data();
+        float* py = posY.data();
+        const float* tx = targetX.data();
+        const float* ty = targetY.data();
+        quint8* arr = arrived.data();
+
+        for (unsigned int i = 0; i < count; i++) {
+            float dx = tx[i] - px[i];
+            float dy = ty[i] - py[i];
+            float length = std::sqrt(dx * dx + dy * dy);
+            bool isArrived = std::fabs(dx) < ARRIVAL_DISTANCE && std::fabs(dy) < ARRIVAL_DISTANCE;
+            float f = isArrived ? 1.0f : std::min(1.0f, step / std::max(length, 0.0001f));
+
+            px[i] += dx * f;
+            py[i] += dy * f;
+            arr[i] = isArrived ? 1 : 0;
+        }
+
+        // remove arrived particles (backwards, swapped in particles are already handled)
+        for (unsigned int i = count; i-- > 0;) {
+            if (arrived[i]) {
+                receivers[i]->showHostAliveEffect();
+                removeParticle(i);
+            }
+        }
+    }
+
+    void PacketParticleSystem::paint(QPainter& painter) {
+        const unsigned int count = posX.size();
+
+        // bucket the particles by color in one counting pass (one brush change per color)
+        const unsigned int colorCount = brushes.size();
+        bucketStarts.assign(colorCount + 1, 0);
+        for (unsigned int i = 0; i < count; i++) {
+            bucketStarts[colorIndex[i] + 1]++;
+        }
+        for (unsigned int c = 0; c < colorCount; c++) {
+            bucketStarts[c + 1] += bucketStarts[c];
+        }
+        paintOrder.resize(count);
+        for (unsigned int i = 0; i < count; i++) {
+            paintOrder[bucketStarts[colorIndex[i]]++] = i;
+        }
+
+        // (bucketStarts[c] is the end of bucket c now)
+        unsigned int bucketBegin = 0;
+        for (unsigned int c = 0; c < colorCount; c++) {
+            unsigned int bucketEnd = bucketStarts[c];
+            if (bucketBegin < bucketEnd) {
+                painter.setBrush(brushes[c]);
+            }
+
+            for (unsigned int b = bucketBegin; b < bucketEnd; b++) {
+                unsigned int i = paintOrder[b];
+
+                QPointF pos = QPointF(posX[i], posY[i]);
+                painter.drawEllipse(pos, RADIUS, RADIUS);
+
+                if (equalPackets[i] > 0) {
+                    QPointF dir = QPointF(dirX[i], dirY[i]);
+                    painter.drawEllipse(pos + dir * 4, RADIUS, RADIUS);
+
+                    if (equalPackets[i] > 1) {
+                        painter.drawEllipse(pos + dir * 8, RADIUS, RADIUS);
+                    }
+                }
+            }
+            bucketBegin = bucketEnd;
+        }
+
+        painter.setBrush(brushIPv6);
+        for (unsigned int i = 0; i < count; i++) {
+            if (isIPv6[i]) {
+                painter.drawEllipse(QPointF(posX[i], posY[i]), RADIUS * 0.3f, RADIUS * 0.3f);
+            }
+        }
+    }
+
+    void PacketParticleSystem::removeHosts(const std::unordered_set<VisibleHost*>& vHosts) {
+        auto bufferEnd = std::remove_if(buffer.begin(), buffer.end(), [&vHosts](const BufferedPacket& packet) {
+            return vHosts.count(packet.key.sender) > 0 || vHosts.count(packet.key.receiver) > 0;
+        });
+        if (bufferEnd != buffer.end()) {
+            buffer.erase(bufferEnd, buffer.end());
+            bufferIndex.clear();
+            for (unsigned int i = 0; i < buffer.size(); i++) {
+                bufferIndex[buffer[i].key] = i;
+            }
+        }
+
+        for (unsigned int i = posX.size(); i-- > 0;) {
+            if (vHosts.count(receivers[i]) > 0) {
+                removeParticle(i);
+            }
+        }
+    }
+
+    size_t PacketParticleSystem::getMemoryUsage() {
+        return posX.capacity() * sizeof(float) * 6
+                + posX.capacity() * (sizeof(quint8) * 4 + sizeof(VisibleHost*))
+                + (paintOrder.capacity() + bucketStarts.capacity()) * sizeof(unsigned int)
+                + buffer.capacity() * sizeof(BufferedPacket)
+                + bufferIndex.size() * (sizeof(BufferKey) + sizeof(unsigned int) + sizeof(void*) * 2);
+    }
+
+    void PacketParticleSystem::clear() {
+        buffer.clear();
+        bufferIndex.clear();
+
+        posX.clear();
+        posY.clear();
+        targetX.clear();
+        targetY.clear();
+        dirX.clear();
+        dirY.clear();
+        arrived.clear();
+        colorIndex.clear();
+        isIPv6.clear();
+        equalPackets.clear();
+        receivers.clear();
+    }
+
+} // namespace Netvisix
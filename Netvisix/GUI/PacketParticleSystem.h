@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PACKETPARTICLESYSTEM_H
+#define PACKETPARTICLESYSTEM_H
+
+#include "Net/NetEvent.h"
+
+#include <QtWidgets>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+
+namespace Netvisix {
+
+    class VisibleHost;
+
+    // packet animation (structure of arrays, one particle per released packet)
+    class PacketParticleSystem {
+
+        public:
+            PacketParticleSystem();
+            virtual ~PacketParticleSystem();
+
+            static QColor getPacketColor(Protocol protocol);
+            static QColor getServiceColor(Service service);
+
+            // (service None: colored by protocol)
+            void addToBuffer(VisibleHost* sender, VisibleHost* receiver, Protocol protocol, Service service, bool isIPv6);
+            void releaseBuffer(std::vector<std::pair<VisibleHost*, VisibleHost*>>& conversations);
+
+            void update(quint64 dt);
+            void paint(QPainter& painter);
+
+            // (buffered packets & particles of removed hosts)
+            void removeHosts(const std::unordered_set<VisibleHost*>& vHosts);
+
+            void clear();
+
+            unsigned int size() { return this->posX.size(); }
+            size_t getMemoryUsage();
+
+            // (0 = unlimited)
+            void setMaxParticles(unsigned int maxParticles) { this->maxParticles = maxParticles; }
+
+        private:
+            struct BufferKey {
+                VisibleHost* sender;
+                VisibleHost* receiver;
+                Protocol protocol;
+                Service service;
+
+                bool operator==(const BufferKey& other) const {
+                    return sender == other.sender && receiver == other.receiver && protocol == other.protocol && service == other.service;
+                }
+            };
+
+            struct BufferKeyHash {
+                std::size_t operator()(const BufferKey& key) const {
+                    std::size_t h = std::hash<VisibleHost*>()(key.sender);
+                    h ^= std::hash<VisibleHost*>()(key.receiver) + 0x9e3779b9 + (h << 6) + (h >> 2);
+                    h ^= std::hash<int>()((int) key.protocol) + 0x9e3779b9 + (h << 6) + (h >> 2);
+                    h ^= std::hash<int>()((int) key.service) + 0x9e3779b9 + (h << 6) + (h >> 2);
+                    return h;
+                }
+            };
+
+            struct BufferedPacket {
+                BufferKey key;
+                bool isIPv6;
+                unsigned int equalPackets;
+            };
+
+            void addParticle(const BufferedPacket& packet);
+
+            // brush index: protocols first, services behind SERVICE_COLOR_OFFSET
+            static QColor getBrushColor(unsigned int colorIndex);
+            void removeParticle(unsigned int index);
+
+            // buffered packets (merged by sender, receiver, protocol & service)
+            std::vector<BufferedPacket> buffer;
+            std::unordered_map<BufferKey, unsigned int, BufferKeyHash> bufferIndex;
+
+            // particles
+            std::vector<float> posX;
+            std::vector<float> posY;
+            std::vector<float> targetX;
+            std::vector<float> targetY;
+            std::vector<float> dirX;
+            std::vector<float> dirY;
+            std::vector<quint8> arrived;
+            std::vector<quint8> colorIndex;
+            std::vector<quint8> isIPv6;
+            std::vector<quint8> equalPackets;
+            std::vector<VisibleHost*> receivers;
+
+            unsigned int maxParticles;
+
+            std::vector<QBrush> brushes;
+
+            // (paint: particle indices bucketed by color, reused each frame)
+            std::vector<unsigned int> bucketStarts;
+            std::vector<unsigned int> paintOrder;
+            QBrush brushIPv6;
+
+            static const unsigned int SERVICE_COLOR_OFFSET = (unsigned int) Protocol::OtherL3 + 1;
+
+            const float SPEED = 0.4f;
+            const float RADIUS = 5;
+            const float ARRIVAL_DISTANCE = 5;
+    };
+
+} // namespace Netvisix
+#endif // PACKETPARTICLESYSTEM_H
@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SpatialGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace Netvisix {
+
+    SpatialGrid::SpatialGrid(float cellSize) {
+        this->cellSize = cellSize;
+        maxRadius = 0;
+    }
+
+    SpatialGrid::~SpatialGrid() {
+    }
+
+    int SpatialGrid::getCellIndex(double coord) const {
+        return (int) std::floor(coord / cellSize);
+    }
+
+    quint64 SpatialGrid::getCellKey(int cellX, int cellY) {
+        return ((quint64) (quint32) cellX << 32) | (quint32) cellY;
+    }
+
+    void SpatialGrid::insert(VisibleHost* vHost, QPointF pos, float radius) {
+        Item item;
+        item.cellKey = getCellKey(getCellIndex(pos.x()), getCellIndex(pos.y()));
+        item.pos = pos;
+        item.radius = radius;
+
+        items[vHost] = item;
+        cells[item.cellKey].push_back(vHost);
+
+        maxRadius = std::max(maxRadius, radius);
+    }
+
+    void SpatialGrid::update(VisibleHost* vHost, QPointF pos, float radius) {
+        auto it = items.find(vHost);
+        if (it == items.end()) {
+            insert(vHost, pos, radius);
+            return;
+        }
+
+        Item& item = it->second;
+        item.pos = pos;
+        item.radius = radius;
+        maxRadius = std::max(maxRadius, radius);
+
+        quint64 cellKey = getCellKey(getCellIndex(pos.x()), getCellIndex(pos.y()));
+        if (cellKey == item.cellKey) {
+            return;
+        }
+
+        // move to the new cell
+        std::vector<VisibleHost*>& oldCell = cells[item.cellKey];
+        oldCell.erase(std::find(oldCell.begin(), oldCell.end(), vHost));
+        if (oldCell.empty()) {
+            cells.erase(item.cellKey);
+        }
+
+        item.cellKey = cellKey;
+        cells[cellKey].push_back(vHost);
+    }
+
+    void SpatialGrid::remove(VisibleHost* vHost) {
+        auto it = items.find(vHost);
+        if (it == items.end()) {
+            return;
+        }
+
+        std::vector<VisibleHost*>& cell = cells[it->second.cellKey];
+        cell.erase(std::find(cell.begin(), cell.end(), vHost));
+        if (cell.empty()) {
+            cells.erase(it->second.cellKey);
+        }
+
+        items.erase(it);
+    }
+
+    void SpatialGrid::clear() {
+        cells.clear();
+        items.clear();
+        maxRadius = 0;
+    }
+
+    void SpatialGrid::getItems(const QRectF& rect, std::vector<VisibleHost*>& result) const {
+        // (items are bucketed by center, so widen the search by the largest stored radius)
+        int minX = getCellIndex(rect.left() - maxRadius);
+        int maxX = getCellIndex(rect.right() + maxRadius);
+        int minY = getCellIndex(rect.top() - maxRadius);
+        int maxY = getCellIndex(rect.bottom() + maxRadius);
+
+        for (int x = minX; x <= maxX; x++) {
+            for (int y = minY; y <= maxY; y++) {
+                auto cellIt = cells.find(getCellKey(x, y));
+                if (cellIt == cells.end()) {
+                    continue;
+                }
+
+                for (VisibleHost* vHost : cellIt->second) {
+                    const Item& item = items.at(vHost);
+                    QRectF itemRect = QRectF(item.pos.x() - item.radius, item.pos.y() - item.radius, item.radius * 2, item.radius * 2);
+                    if (itemRect.intersects(rect)) {
+                        result.push_back(vHost);
+                    }
+                }
+            }
+        }
+    }
+
+    size_t SpatialGrid::getMemoryUsage() const {
+        // (hash nodes estimated with two pointers overhead)
+        size_t memoryUsage = items.size() * (sizeof(VisibleHost*) + sizeof(Item) + sizeof(void*) * 2);
+        for (const auto& cell : cells) {
+            memoryUsage += sizeof(quint64) + sizeof(std::vector<VisibleHost*>) + sizeof(void*) * 2
+                    + cell.second.capacity() * sizeof(VisibleHost*);
+        }
+        return memoryUsage;
+    }
+
+} // namespace Netvisix
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <QRectF>
+
+#include <unordered_map>
+#include <vector>
+
+
+namespace Netvisix {
+
+    class VisibleHost;
+
+    // uniform grid over host positions (placement collision checks & hit-testing)
+    class SpatialGrid {
+
+        public:
+            SpatialGrid(float cellSize);
+            virtual ~SpatialGrid();
+
+            void insert(VisibleHost* vHost, QPointF pos, float radius);
+            void update(VisibleHost* vHost, QPointF pos, float radius);
+            void remove(VisibleHost* vHost);
+            void clear();
+
+            void getItems(const QRectF& rect, std::vector<VisibleHost*>& result) const;
+
+            float getMaxRadius() const { return this->maxRadius; }
+            unsigned int size() const { return this->items.size(); }
+            size_t getMemoryUsage() const;
+
+        private:
+            struct Item {
+                quint64 cellKey;
+                QPointF pos;
+                float radius;
+            };
+
+            int getCellIndex(double coord) const;
+            static quint64 getCellKey(int cellX, int cellY);
+
+            std::unordered_map<quint64, std::vector<VisibleHost*>> cells;
+            std::unordered_map<VisibleHost*, Item> items;
+
+            float cellSize;
+            float maxRadius;
+    };
+
+} // namespace Netvisix
+#endif // SPATIALGRID_H
@@ -49,6 +49,10 @@ namespace Netvisix {
 
         ui->labelInfo->setStyleSheet("QLabel { color : red; }");
 
+        const char* subnetListToolTip = "Comma separated list, optionally named: office=10.1.0.0/16, lab=10.2.0.0/16, lab@20=10.2.0.0/16 (VLAN 20 only)";
+        ui->lineEditNetworkIPv4->setToolTip(subnetListToolTip);
+        ui->lineEditNetworkIPv6->setToolTip(subnetListToolTip);
+
         MainWindow::updateAllWidgetFonts();
     }
 
@@ -111,12 +115,12 @@ void Netvisix::StartCapturePopup::on_buttonStart_clicked() {
     // check subnet validity
     std::string subnetStringIPv4 = ui->lineEditNetworkIPv4->text().toStdString();
     std::string subnetStringIPv6 = ui->lineEditNetworkIPv6->text().toStdString();
-    if (NetUtil::getIsSubnetStringIPv4Valid(subnetStringIPv4) == false) {
+    if (NetUtil::getIsSubnetListIPv4Valid(subnetStringIPv4) == false) {
         ui->labelInfo->setText("Invalid IPv4 Subnet!");
         return;
     }
 
-    if (NetUtil::getIsSubnetStringIPv6Valid(subnetStringIPv6) == false) {
+    if (NetUtil::getIsSubnetListIPv6Valid(subnetStringIPv6) == false) {
         ui->labelInfo->setText("Invalid IPv6 Subnet!");
         return;
     }
@@ -24,17 +24,19 @@
 #include "Net/NetEvent.h"
 #include "Net/NetEventManager.h"
 #include "Net/NetUtil.h"
+#include "Net/ServiceTable.h"
 
 #include <QDateTime>
 #include <QTimer>
 #include <QTableWidget>
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 
 namespace Netvisix {
 
-    StatisticPopup::StatisticPopup(NetStatistic* statistic, std::string title, QWidget* parent) :
+    StatisticPopup::StatisticPopup(NetStatistic* statistic, std::string title, QWidget* parent, Host* host) :
             QWidget(parent, Qt::Window),
             ui(new Ui::StatisticPopup) {
 
@@ -43,6 +45,10 @@ namespace Netvisix {
         setAttribute(Qt::WA_DeleteOnClose);
 
         this->statistic = statistic;
+        this->host = host;
+        if (host != nullptr) {
+            NetEventManager::SharedInstance()->addHostRemovalListener(this);
+        }
 
         QPalette Pal(palette());
         Pal.setColor(QPalette::Background, QColor(200, 200, 200, 255));
@@ -55,12 +61,12 @@ namespace Netvisix {
 
         timer = new QTimer();
         QObject::connect(timer, SIGNAL(timeout()), this, SLOT(updateLoop()));
-        timer->start();
+        timer->start(UPDATE_INTERVAL);
 
         items = new std::vector<StatisticItem*>();
 
         float frameWidth = START_POS_X + 5 * OFFSET_X;
-        float frameHeight = START_POS_Y + 16 * OFFSET_Y + 5;
+        float frameHeight = START_POS_Y + (18 + ServiceTable::SERVICE_COUNT - 1) * OFFSET_Y + 5;
         setFixedSize(frameWidth, frameHeight);
 
         // gui layout
@@ -95,12 +101,25 @@ namespace Netvisix {
         addItem(statistic->getItem(IPVersion::IPV6, Protocol::UDP), "UDP", 14);
         addItem(statistic->getItem(IPVersion::IPV6, Protocol::OtherL3), "Other L3", 15);
 
+        // services (by port, IPv4 & IPv6)
+        posY = START_POS_Y + 16.6f * OFFSET_Y;
+        createSubTitleLabel(START_POS_X, posY, "Services");
+        createLine(posY + 25);
+
+        for (unsigned int i = 1; i < ServiceTable::SERVICE_COUNT; i++) {
+            addItem(&emptyItem, ServiceTable::getServiceString((Service) i), 17 + i, (Service) i);
+        }
+
         updateStatisticDisplay();
 
         MainWindow::updateAllWidgetFonts();
     }
 
     StatisticPopup::~StatisticPopup() {
+        if (host != nullptr) {
+            NetEventManager::SharedInstance()->removeHostRemovalListener(this);
+        }
+
         delete timer;
         delete ui;
 
@@ -110,12 +129,21 @@ namespace Netvisix {
         delete items;
     }
 
-    void StatisticPopup::addItem(NetStatistic::Item *item, std::string name, int y) {
+    void StatisticPopup::onHostsRemoved(const std::vector<Host*>& hosts) {
+        if (std::find(hosts.begin(), hosts.end(), host) != hosts.end()) {
+            // (no more updates from the deleted statistic)
+            timer->stop();
+            close();
+        }
+    }
+
+    void StatisticPopup::addItem(NetStatistic::Item *item, std::string name, int y, Service service) {
         float posY = START_POS_Y + y * OFFSET_Y;
 
         StatisticItem* sItem = new StatisticItem();
 
         sItem->item = item;
+        sItem->service = service;
 
         sItem->labelName = new QLabel(name.c_str(), this);
         sItem->labelName->move(START_POS_X, posY);
@@ -165,6 +193,14 @@ namespace Netvisix {
         for (unsigned int i = 0; i < items->size(); i++) {
             StatisticItem* sItem = items->at(i);
 
+            // (service counters are created by the capture thread on first use)
+            if (sItem->item == &emptyItem) {
+                NetStatistic::Item* serviceItem = statistic->getServiceItem(sItem->service);
+                if (serviceItem != nullptr) {
+                    sItem->item = serviceItem;
+                }
+            }
+
             handleCountTextColor(sItem->labelFramesSnt, sItem->item->framesSnt);
             sItem->labelFramesSnt->setText(QString::number(sItem->item->framesSnt));
 
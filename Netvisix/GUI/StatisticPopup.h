@@ -21,6 +21,7 @@
 #define STATISTICPOPUP_H
 
 #include "Net/NetStatistic.h"
+#include "Net/IHostRemovalListener.h"
 
 #include <QWidget>
 #include <QLabel>
@@ -36,11 +37,12 @@ namespace Netvisix {
     enum class Protocol;
     enum class IPVersion;
 
-    class StatisticPopup : public QWidget {
+    class StatisticPopup : public QWidget, public IHostRemovalListener {
 
         public:
             struct StatisticItem {
                 NetStatistic::Item* item;
+                Service service;
                 QLabel* labelName;
                 QLabel* labelFramesSnt;
                 QLabel* labelFramesRcv;
@@ -48,16 +50,19 @@ namespace Netvisix {
                 QLabel* labelBytesRcv;
             };
 
-            explicit StatisticPopup(NetStatistic* statistic, std::string title, QWidget* parent);
+            // (host: owner of the statistic, the popup closes when the host is evicted)
+            explicit StatisticPopup(NetStatistic* statistic, std::string title, QWidget* parent, Host* host = nullptr);
             ~StatisticPopup();
 
+            virtual void onHostsRemoved(const std::vector<Host*>& hosts);
+
         public slots:
              void updateLoop();
 
         private:
             Q_OBJECT
 
-            void addItem(NetStatistic::Item* item, std::string name, int y);
+            void addItem(NetStatistic::Item* item, std::string name, int y, Service service = Service::None);
 
             void updateStatisticDisplay();
 
@@ -71,16 +76,22 @@ namespace Netvisix {
             Ui::StatisticPopup *ui;
 
             NetStatistic* statistic;
+            Host* host;
 
             QTimer* timer;
             quint64 lastUpdateTime;
 
             std::vector<StatisticItem*>* items;
 
+            // (zero counters for services the statistic has not seen yet)
+            NetStatistic::Item emptyItem;
+
             const float START_POS_X = 10;
             const float START_POS_Y = 40;
             const float OFFSET_X = 140;
             const float OFFSET_Y = 24;
+
+            const int UPDATE_INTERVAL = 100;
     };
 
 } // namespace Netvisix
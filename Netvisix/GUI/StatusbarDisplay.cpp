@@ -20,7 +20,11 @@
 #include "StatusbarDisplay.h"
 #include "GUI/MainWindow.h"
 #include "ui_MainWindow.h"
+#include "GUI/FrameScheduler.h"
 #include "Net/NetEventManager.h"
+#include "Net/NetEvent.h"
+#include "Net/NetUtil.h"
+#include "GUI/HostList.h"
 
 #include <QDebug>
 #include <QDateTime>
@@ -43,6 +47,12 @@ namespace Netvisix {
         labelFPS = new QLabel();
         mainWindow->getUI()->statusBar->addWidget(labelFPS);
 
+        labelFrameTime = new QLabel();
+        mainWindow->getUI()->statusBar->addWidget(labelFrameTime);
+
+        labelMemory = new QLabel();
+        mainWindow->getUI()->statusBar->addWidget(labelMemory);
+
         fpsCounter = 0;
 	}
 
@@ -50,6 +60,8 @@ namespace Netvisix {
         delete labelHandledPacketsCount;
         delete labelVisibleHostsCount;
         delete labelFPS;
+        delete labelFrameTime;
+        delete labelMemory;
 	}
 
     void StatusbarDisplay::updateStatusbar(quint64 dt) {
@@ -63,7 +75,47 @@ namespace Netvisix {
 
         std::string handledPackets = " Handled Packets: ";
         handledPackets += std::to_string(NetEventManager::SharedInstance()->getNetEventCount());
+
+        // per vlan frames & bytes (trunk captures)
+        std::vector<unsigned int> vlanIDs = NetEventManager::SharedInstance()->getVlanIDs();
+        std::string handledPacketsToolTip = "";
+        if (vlanIDs.size() > 1 || (vlanIDs.size() == 1 && vlanIDs.front() != 0)) {
+            handledPackets += " (VLANs: " + std::to_string(vlanIDs.size()) + ")";
+            for (unsigned int vlanID : vlanIDs) {
+                unsigned long long frames;
+                unsigned long long bytes;
+                if (NetEventManager::SharedInstance()->getVlanCounters(vlanID, frames, bytes) == false) {
+                    continue;
+                }
+                handledPacketsToolTip += (handledPacketsToolTip.empty() ? "" : "\n");
+                handledPacketsToolTip += "VLAN " + ((vlanID == 0) ? std::string("untagged") : NetUtil::getVlanString(vlanID));
+                handledPacketsToolTip += ": " + std::to_string(frames) + " frames, " + NetUtil::getByteString(bytes);
+            }
+        }
+
+        // per tunnel frames & bytes (decapsulated overlay traffic)
+        std::vector<std::pair<Tunnel, uint32_t>> tunnels = NetEventManager::SharedInstance()->getTunnels();
+        if (tunnels.empty() == false) {
+            handledPackets += " (Tunnels: " + std::to_string(tunnels.size()) + ")";
+            for (auto& tunnel : tunnels) {
+                unsigned long long frames;
+                unsigned long long bytes;
+                if (NetEventManager::SharedInstance()->getTunnelCounters(tunnel.first, tunnel.second, frames, bytes) == false) {
+                    continue;
+                }
+                handledPacketsToolTip += (handledPacketsToolTip.empty() ? "" : "\n");
+                handledPacketsToolTip += NetEvent::getTunnelString(tunnel.first, tunnel.second);
+                handledPacketsToolTip += ": " + std::to_string(frames) + " frames, " + NetUtil::getByteString(bytes);
+            }
+        }
+
+        unsigned int multicastGroupCount = NetEventManager::SharedInstance()->getMulticastGroupCount();
+        if (multicastGroupCount > 0) {
+            handledPackets += " (Multicast Groups: " + std::to_string(multicastGroupCount) + ")";
+        }
+
         labelHandledPacketsCount->setText(handledPackets.c_str());
+        labelHandledPacketsCount->setToolTip(QString::fromUtf8(handledPacketsToolTip.c_str()));
 
         std::string activeHosts = " |  Hosts: ";
         activeHosts += std::to_string(mainWindow->getUI()->widgetNetView->getActiveHostsCount());
@@ -74,6 +126,50 @@ namespace Netvisix {
         fpsString += std::to_string(fps);
         labelFPS->setText(fpsString.c_str());
         fpsCounter = 0;
+
+        FrameScheduler* frameScheduler = mainWindow->getFrameScheduler();
+        QString frameTime = QString(" |  Frame Time (p50/p95/p99): %1 / %2 / %3 ms")
+                .arg(frameScheduler->getFrameTimePercentile(50), 0, 'f', 1)
+                .arg(frameScheduler->getFrameTimePercentile(95), 0, 'f', 1)
+                .arg(frameScheduler->getFrameTimePercentile(99), 0, 'f', 1);
+
+        if (frameScheduler->getRenderQuality() == RenderQuality::Medium) {
+            frameTime += "  [reduced quality]";
+        }
+        else if (frameScheduler->getRenderQuality() == RenderQuality::Low) {
+            frameTime += "  [low quality]";
+        }
+        labelFrameTime->setText(frameTime);
+
+        NetEventManager* nm = NetEventManager::SharedInstance();
+        std::string memory = " |  Memory (hosts/view/list): ";
+        memory += NetUtil::getByteString(nm->getMemoryUsage()) + " / ";
+        memory += NetUtil::getByteString(mainWindow->getUI()->widgetNetView->getMemoryUsage()) + " / ";
+        memory += NetUtil::getByteString(mainWindow->getHostList()->getMemoryUsage());
+        memory += "  (budget " + NetUtil::getByteString(nm->getMemoryBudget()) + ")";
+        std::string memoryToolTip = "";
+        if (nm->getEvictedHostCount() > 0) {
+            // (traffic of the evicted hosts, rolled up into "other")
+            unsigned long long otherBytes = 0;
+            for (NetArea netArea : { NetArea::SUBNET, NetArea::OUTSIDE_SUBNET }) {
+                unsigned long long frames;
+                unsigned long long bytes;
+                nm->getOtherCounters(netArea, frames, bytes);
+                otherBytes += bytes;
+
+                memoryToolTip += (memoryToolTip.empty() ? "" : "\n");
+                memoryToolTip += std::string("Other (evicted), ") + ((netArea == NetArea::SUBNET) ? "subnet" : "outside subnet");
+                memoryToolTip += ": " + std::to_string(frames) + " frames, " + NetUtil::getByteString(bytes) + " (sent + received)";
+            }
+            memory += "  |  Evicted Hosts: " + std::to_string(nm->getEvictedHostCount());
+            memory += " (Other: " + NetUtil::getByteString(otherBytes) + ")";
+        }
+        unsigned long evictedBindingCount = nm->getEvictedBindingCount();
+        if (evictedBindingCount > 0) {
+            memory += "  |  Evicted Bindings: " + std::to_string(evictedBindingCount);
+        }
+        labelMemory->setText(QString::fromUtf8(memory.c_str()));
+        labelMemory->setToolTip(QString::fromUtf8(memoryToolTip.c_str()));
     }
 	
 } // namespace Netvisix
@@ -48,6 +48,8 @@ namespace Netvisix {
             QLabel* labelHandledPacketsCount;
             QLabel* labelVisibleHostsCount;
             QLabel* labelFPS;
+            QLabel* labelFrameTime;
+            QLabel* labelMemory;
 
             int fpsCounter;
 			
@@ -23,7 +23,8 @@
 #include "Net/NetEventManager.h"
 #include "Net/NetEvent.h"
 #include "Net/Host.h"
-#include "GUI/VisiblePacket.h"
+#include "GUI/PacketParticleSystem.h"
+#include "GUI/FrameScheduler.h"
 
 #include <QWidget>
 
@@ -34,6 +35,7 @@ namespace Netvisix {
 
     VisibleHost::VisibleHost(NetView* netView, Host* host) : VisibleBase(netView) {
         this->host = host;
+        this->layoutIndex = -1;
 
         Config::Theme* theme = Config::Settings::SharedInstance()->theme;
 
@@ -50,6 +52,8 @@ namespace Netvisix {
 
         colorLocalInterfaceMarker = theme->hostLocalInterfaceMarkerColor;
 
+        penAnomalyMarker = QPen(theme->hostAnomalyMarkerColor, 3);
+
         visibleTimer    = 0;
         isVisible       = true;
 
@@ -75,6 +79,12 @@ namespace Netvisix {
         delete mcEffectDataList;
     }
 
+    size_t VisibleHost::getMemoryUsage() {
+        return sizeof(VisibleHost) + sizeof(std::vector<MulticastEffectData*>)
+                + mcEffectDataList->capacity() * sizeof(MulticastEffectData*)
+                + mcEffectDataList->size() * sizeof(MulticastEffectData);
+    }
+
     void VisibleHost::showMulticastEffect(NetEvent* netEvent) {
         // get next free mced
         MulticastEffectData* mced = nullptr;
@@ -92,7 +102,7 @@ namespace Netvisix {
         mced->isActive = true;
         mced->currentRadius = getRadius();
 
-        mced->color = VisiblePacket::getPacketColor(netEvent->getTopLevelProtocol());
+        mced->color = PacketParticleSystem::getPacketColor(netEvent->getTopLevelProtocol());
 
         if (netEvent->isIPv6()) {
              mced->brush = QBrush(mced->color, MULTICAST_BRUSH_STYLE);
@@ -169,14 +179,17 @@ namespace Netvisix {
             return;
         }
 
-        painter.setRenderHint(QPainter::Antialiasing, true);
+        bool highQuality = (netView->getRenderQuality() == RenderQuality::High);
+        painter.setRenderHint(QPainter::Antialiasing, highQuality);
 
         // multicast effect
-        for (unsigned int i = 0; i < mcEffectDataList->size(); i++) {
-            MulticastEffectData* m = mcEffectDataList->at(i);
-            if (m->isActive) {
-                painter.setBrush(m->brush);
-                painter.drawEllipse(getPosition(), m->currentRadius, m->currentRadius);
+        if (highQuality) {
+            for (unsigned int i = 0; i < mcEffectDataList->size(); i++) {
+                MulticastEffectData* m = mcEffectDataList->at(i);
+                if (m->isActive) {
+                    painter.setBrush(m->brush);
+                    painter.drawEllipse(getPosition(), m->currentRadius, m->currentRadius);
+                }
             }
         }
 
@@ -196,6 +209,14 @@ namespace Netvisix {
             painter.drawEllipse(getPosition(), getRadius() * 0.5f, getRadius() * 0.5f);
         }
 
+        if (host->getAnomalies() != 0) {
+            QPen pen = painter.pen();
+            painter.setPen(penAnomalyMarker);
+            painter.setBrush(Qt::NoBrush);
+            painter.drawEllipse(getPosition(), getRadius() * 1.4f, getRadius() * 1.4f);
+            painter.setPen(pen);
+        }
+
         painter.setRenderHint(QPainter::Antialiasing, false);
     }
 
@@ -52,6 +52,11 @@ namespace Netvisix {
 
             bool getIsAlive() { return aliveEffectActive; }
 
+            size_t getMemoryUsage();
+
+            int getLayoutIndex() { return this->layoutIndex; }
+            void setLayoutIndex(int layoutIndex) { this->layoutIndex = layoutIndex; }
+
         private:
             struct MulticastEffectData {
                 bool isActive = false;
@@ -74,10 +79,15 @@ namespace Netvisix {
 
             Host* host;
 
+            int layoutIndex;
+
             bool isMarked;
             QBrush brushMarked;
 
             QColor colorLocalInterfaceMarker;
+
+            // (ring around hosts flagged by the AnomalyDetector)
+            QPen penAnomalyMarker;
         };
 
 } // namespace Netvisix
@@ -20,6 +20,8 @@
 #include "VisibleLink.h"
 #include "Config.h"
 #include "GUI/VisibleHost.h"
+#include "GUI/FrameScheduler.h"
+#include "NetView.h"
 
 
 namespace Netvisix {
@@ -27,7 +29,13 @@ namespace Netvisix {
     VisibleLink::VisibleLink(NetView* netView) : VisibleBase(netView) {
         Config::Theme* theme = Config::Settings::SharedInstance()->theme;
         color = theme->linkColor;
-        isActive = false;
+
+        sender = nullptr;
+        receiver = nullptr;
+        stayDuration = 0;
+        expiryTime = 0;
+        poolIndex = 0;
+        poolKey = 0;
     }
 
     VisibleLink::~VisibleLink() {
@@ -46,31 +54,17 @@ namespace Netvisix {
         this->sender = sender;
         this->receiver = receiver;
 
-        timer = 0;
         double diffX = receiver->getPosition().x() - sender->getPosition().x();
         double diffY = receiver->getPosition().y() - sender->getPosition().y();
         double length = std::sqrt(diffX * diffX + diffY * diffY);
         stayDuration = length / 0.35f;
-
-        isActive = true;
-    }
-
-    void VisibleLink::onVisibleUpdate(quint64 dt) {
-        if (isActive) {
-            timer += dt;
-            if (timer >= stayDuration) {
-                isActive = false;
-            }
-        }
     }
 
     void VisibleLink::onVisiblePaint(QPainter& painter) {
-        if (isActive) {
-            painter.setRenderHint(QPainter::Antialiasing, true);
-            painter.setPen(color);
-            painter.drawLine(sender->getPosition(), receiver->getPosition());
-            painter.setRenderHint(QPainter::Antialiasing, false);
-        }
+        painter.setRenderHint(QPainter::Antialiasing, netView->getRenderQuality() == RenderQuality::High);
+        painter.setPen(color);
+        painter.drawLine(sender->getPosition(), receiver->getPosition());
+        painter.setRenderHint(QPainter::Antialiasing, false);
     }
 
 } // namespace Netvisix
@@ -33,23 +33,35 @@ namespace Netvisix {
             VisibleLink(NetView* netView);
             virtual ~VisibleLink();
 
-            virtual void onVisibleUpdate(quint64 dt);
             virtual void onVisiblePaint(QPainter& painter);
 
-            bool getIsActive() { return this->isActive; }
-            void setIsActive(bool isActive) { this->isActive = isActive; }
-
             bool equals(VisibleHost* sender, VisibleHost* receiver);
 
+            VisibleHost* getSender() { return this->sender; }
+            VisibleHost* getReceiver() { return this->receiver; }
+
             void showLink(VisibleHost* sender, VisibleHost* receiver);
 
+            float getStayDuration() { return this->stayDuration; }
+
+            quint64 getExpiryTime() { return this->expiryTime; }
+            void setExpiryTime(quint64 expiryTime) { this->expiryTime = expiryTime; }
+
+            unsigned int getPoolIndex() { return this->poolIndex; }
+            void setPoolIndex(unsigned int poolIndex) { this->poolIndex = poolIndex; }
+
+            quint64 getPoolKey() { return this->poolKey; }
+            void setPoolKey(quint64 poolKey) { this->poolKey = poolKey; }
+
         private:
             VisibleHost* sender;
             VisibleHost* receiver;
 
-            bool isActive;
-            quint64 timer;
             float stayDuration;
+
+            quint64 expiryTime;
+            unsigned int poolIndex;
+            quint64 poolKey;
     };
 
 } // namespace Netvisix
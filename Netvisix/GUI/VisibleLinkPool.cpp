@@ -0,0 +1,189 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VisibleLinkPool.h"
+#include "VisibleLink.h"
+#include "VisibleHost.h"
+#include "Net/Host.h"
+
+#include <algorithm>
+
+
+namespace Netvisix {
+
+    VisibleLinkPool::VisibleLinkPool(NetView* netView) {
+        this->netView = netView;
+
+        wheel = std::vector<std::vector<VisibleLink*>>(SLOT_COUNT);
+        wheelSlot = 0;
+        wheelTime = 0;
+        currentTime = 0;
+    }
+
+    VisibleLinkPool::~VisibleLinkPool() {
+        for (VisibleLink* link : activeLinks) {
+            delete link;
+        }
+
+        for (VisibleLink* link : freeLinks) {
+            delete link;
+        }
+    }
+
+    quint64 VisibleLinkPool::getHostPairKey(VisibleHost* a, VisibleHost* b) {
+        quint64 idA = a->getHost()->getID();
+        quint64 idB = b->getHost()->getID();
+        return (std::min(idA, idB) << 32) | std::max(idA, idB);
+    }
+
+    void VisibleLinkPool::showLink(VisibleHost* sender, VisibleHost* receiver) {
+        quint64 key = getHostPairKey(sender, receiver);
+
+        auto it = linkIndex.find(key);
+        if (it != linkIndex.end()) {
+            // (already scheduled, the wheel picks up the new expiry time)
+            VisibleLink* link = it->second;
+            link->showLink(sender, receiver);
+            link->setExpiryTime(std::max(link->getExpiryTime(), currentTime + (quint64) link->getStayDuration()));
+            return;
+        }
+
+        VisibleLink* link = nullptr;
+        if (freeLinks.empty()) {
+            link = new VisibleLink(netView);
+        }
+        else {
+            link = freeLinks.back();
+            freeLinks.pop_back();
+        }
+
+        link->showLink(sender, receiver);
+        link->setExpiryTime(currentTime + (quint64) link->getStayDuration());
+        link->setPoolIndex(activeLinks.size());
+        link->setPoolKey(key);
+
+        activeLinks.push_back(link);
+        linkIndex[key] = link;
+
+        schedule(link);
+    }
+
+    void VisibleLinkPool::schedule(VisibleLink* link) {
+        quint64 ticks = 1;
+        if (link->getExpiryTime() > wheelTime) {
+            ticks = (link->getExpiryTime() - wheelTime + SLOT_DURATION - 1) / SLOT_DURATION;
+        }
+
+        // (expiry beyond the wheel horizon: revisit after one round)
+        ticks = std::max((quint64) 1, std::min(ticks, (quint64) SLOT_COUNT - 1));
+
+        wheel[(wheelSlot + ticks) % SLOT_COUNT].push_back(link);
+    }
+
+    void VisibleLinkPool::expire(VisibleLink* link) {
+        linkIndex.erase(link->getPoolKey());
+
+        // (swap and pop)
+        unsigned int index = link->getPoolIndex();
+        VisibleLink* last = activeLinks.back();
+        activeLinks[index] = last;
+        last->setPoolIndex(index);
+        activeLinks.pop_back();
+
+        freeLinks.push_back(link);
+    }
+
+    void VisibleLinkPool::update(quint64 dt) {
+        currentTime += dt;
+
+        std::vector<VisibleLink*> dueLinks;
+        while (wheelTime + SLOT_DURATION <= currentTime) {
+            wheelTime += SLOT_DURATION;
+            wheelSlot = (wheelSlot + 1) % SLOT_COUNT;
+
+            dueLinks.clear();
+            dueLinks.swap(wheel[wheelSlot]);
+
+            for (VisibleLink* link : dueLinks) {
+                if (link->getExpiryTime() > wheelTime) {
+                    // refreshed since it was scheduled
+                    schedule(link);
+                    continue;
+                }
+
+                expire(link);
+            }
+        }
+    }
+
+    void VisibleLinkPool::paint(QPainter& painter) {
+        for (VisibleLink* link : activeLinks) {
+            link->onVisiblePaint(painter);
+        }
+    }
+
+    void VisibleLinkPool::removeHosts(const std::unordered_set<VisibleHost*>& vHosts) {
+        std::unordered_set<VisibleLink*> removedLinks;
+        for (unsigned int i = 0; i < activeLinks.size();) {
+            VisibleLink* link = activeLinks[i];
+            if (vHosts.count(link->getSender()) > 0 || vHosts.count(link->getReceiver()) > 0) {
+                removedLinks.insert(link);
+                expire(link);
+            }
+            else {
+                i++;
+            }
+        }
+
+        if (removedLinks.empty()) {
+            return;
+        }
+
+        // (the wheel must not keep entries of links that go back to the free list)
+        for (std::vector<VisibleLink*>& slot : wheel) {
+            slot.erase(std::remove_if(slot.begin(), slot.end(), [&removedLinks](VisibleLink* link) {
+                return removedLinks.count(link) > 0;
+            }), slot.end());
+        }
+    }
+
+    size_t VisibleLinkPool::getMemoryUsage() {
+        size_t scheduled = 0;
+        for (std::vector<VisibleLink*>& slot : wheel) {
+            scheduled += slot.capacity();
+        }
+
+        return (activeLinks.size() + freeLinks.size()) * sizeof(VisibleLink)
+                + (activeLinks.capacity() + freeLinks.capacity() + scheduled) * sizeof(VisibleLink*)
+                + linkIndex.size() * (sizeof(quint64) + sizeof(VisibleLink*) + sizeof(void*) * 2);
+    }
+
+    void VisibleLinkPool::clear() {
+        for (VisibleLink* link : activeLinks) {
+            freeLinks.push_back(link);
+        }
+        activeLinks.clear();
+        linkIndex.clear();
+
+        for (std::vector<VisibleLink*>& slot : wheel) {
+            slot.clear();
+        }
+    }
+
+} // namespace Netvisix
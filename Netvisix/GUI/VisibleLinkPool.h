@@ -0,0 +1,79 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VISIBLELINKPOOL_H
+#define VISIBLELINKPOOL_H
+
+#include <QtWidgets>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+
+namespace Netvisix {
+
+    class NetView;
+    class VisibleHost;
+    class VisibleLink;
+
+    // active links by (unordered) host pair, expired through a timer wheel
+    class VisibleLinkPool {
+
+        public:
+            VisibleLinkPool(NetView* netView);
+            virtual ~VisibleLinkPool();
+
+            void showLink(VisibleHost* sender, VisibleHost* receiver);
+
+            void update(quint64 dt);
+            void paint(QPainter& painter);
+
+            // (links of removed hosts)
+            void removeHosts(const std::unordered_set<VisibleHost*>& vHosts);
+
+            void clear();
+
+            unsigned int size() { return this->activeLinks.size(); }
+            size_t getMemoryUsage();
+
+        private:
+            static quint64 getHostPairKey(VisibleHost* a, VisibleHost* b);
+
+            void schedule(VisibleLink* link);
+            void expire(VisibleLink* link);
+
+            NetView* netView;
+
+            std::unordered_map<quint64, VisibleLink*> linkIndex;
+            std::vector<VisibleLink*> activeLinks;
+            std::vector<VisibleLink*> freeLinks;
+
+            // timer wheel
+            std::vector<std::vector<VisibleLink*>> wheel;
+            unsigned int wheelSlot;
+            quint64 wheelTime;
+            quint64 currentTime;
+
+            const quint64 SLOT_DURATION = 50;
+            const unsigned int SLOT_COUNT = 256;
+    };
+
+} // namespace Netvisix
+#endif // VISIBLELINKPOOL_H
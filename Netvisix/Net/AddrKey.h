@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ADDRKEY_H
+#define ADDRKEY_H
+
+#include <tins.h>
+
+#include <functional>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // (vlan, ip address) hash map key, ipv4 addresses as ::ffff:a.b.c.d
+    // (address bytes copied as they are, network byte order)
+    struct AddrKey {
+        unsigned int vlanID;
+        uint64_t high;
+        uint64_t low;
+
+        AddrKey() : vlanID(0), high(0), low(0) { }
+
+        AddrKey(const Tins::IPv4Address& ipv4Addr, unsigned int vlanID) {
+            uint32_t addrRaw = ipv4Addr;
+            set((const uint8_t*) &addrRaw, 4, vlanID);
+        }
+
+        AddrKey(const Tins::IPv6Address& ipv6Addr, unsigned int vlanID) {
+            set(ipv6Addr.begin(), 16, vlanID);
+        }
+
+        // addrLength 4 or 16
+        AddrKey(const uint8_t* addr, unsigned int addrLength, unsigned int vlanID) {
+            set(addr, addrLength, vlanID);
+        }
+
+        void set(const uint8_t* addr, unsigned int addrLength, unsigned int vlanID) {
+            this->vlanID = vlanID;
+            if (addrLength == 4) {
+                uint8_t mapped[8] = { 0, 0, 0xff, 0xff, addr[0], addr[1], addr[2], addr[3] };
+                high = 0;
+                std::memcpy(&low, mapped, 8);
+            }
+            else {
+                std::memcpy(&high, addr, 8);
+                std::memcpy(&low, addr + 8, 8);
+            }
+        }
+
+        bool operator==(const AddrKey& other) const {
+            return vlanID == other.vlanID && high == other.high && low == other.low;
+        }
+    };
+
+    struct AddrKeyHash {
+        size_t operator()(const AddrKey& key) const {
+            return std::hash<uint64_t>()(key.high ^ (key.low * 0x9e3779b97f4a7c15ull) ^ ((uint64_t) key.vlanID << 40));
+        }
+    };
+
+} // namespace Netvisix
+#endif // ADDRKEY_H
@@ -0,0 +1,206 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AnomalyDetector.h"
+#include "Net/NetEvent.h"
+#include "Net/ServiceTable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+namespace Netvisix {
+
+    AnomalyDetector::AnomalyDetector() {
+        for (int i = 0; i < 2; i++) {
+            arpCounts.counters[i].assign(DEPTH * WIDTH, 0);
+            synCounts.counters[i].assign(DEPTH * WIDTH, 0);
+            distinctPorts.cells[i].assign(DEPTH * WIDTH * 2, 0);
+            distinctHosts.cells[i].assign(DEPTH * WIDTH * 2, 0);
+        }
+
+        generation = 0;
+        windowStartTime = 0;
+
+        // linear counting: n = -m * ln(zeros / m)
+        distinctZerosMin = (unsigned int) (CELL_BITS * std::exp(-(double) DISTINCT_THRESHOLD / CELL_BITS));
+    }
+
+    AnomalyDetector::~AnomalyDetector() {
+    }
+
+    void AnomalyDetector::handleNetEvent(NetEvent* ne, long long currentTime, uint8_t& srcAnomalies, uint8_t& dstAnomalies) {
+        srcAnomalies = 0;
+        dstAnomalies = 0;
+
+        if (currentTime - windowStartTime >= WINDOW_DURATION) {
+            rotate(currentTime);
+        }
+
+        // arp storm (frames per source mac)
+        if (ne->l2Protocol == Protocol::ARP) {
+            if (addCount(arpCounts, getKey(ne->srcAddrHW.begin(), 6, ne->vlanID)) > ARP_STORM_THRESHOLD) {
+                srcAnomalies |= ANOMALY_ARP_STORM;
+            }
+            return;
+        }
+
+        // connection attempts only (tcp syn, udp from a client port to a server port), the answers of
+        // dns / ntp / ... servers come from their service port and go to many clients
+        bool isAttempt = ne->isTCPSYN;
+        if (ne->l3Protocol == Protocol::UDP) {
+            bool isServerSrcPort = ne->srcPort < SYSTEM_PORT_END || ServiceTable::getIsKnownPort(true, ne->srcPort);
+            isAttempt = (ne->dstPort < ServiceTable::EPHEMERAL_PORT_MIN && isServerSrcPort == false);
+        }
+        if (isAttempt == false) {
+            return;
+        }
+
+        uint64_t srcKey;
+        uint64_t dstKey;
+        if (ne->isIPv4()) {
+            uint32_t srcAddrRaw = ne->srcAddrIPv4;
+            uint32_t dstAddrRaw = ne->dstAddrIPv4;
+            srcKey = getKey((const uint8_t*) &srcAddrRaw, 4, ne->vlanID);
+            dstKey = getKey((const uint8_t*) &dstAddrRaw, 4, ne->vlanID);
+        }
+        else if (ne->isIPv6()) {
+            srcKey = getKey(ne->srcAddrIPv6.begin(), 16, ne->vlanID);
+            dstKey = getKey(ne->dstAddrIPv6.begin(), 16, ne->vlanID);
+        }
+        else {
+            return;
+        }
+
+        // port scan (distinct destination ports), host sweep (distinct destination hosts)
+        if (addDistinct(distinctPorts, srcKey, getHash(ne->dstPort + ((uint64_t) ne->isTCPSYN << 16)))) {
+            srcAnomalies |= ANOMALY_PORT_SCAN;
+        }
+        if (addDistinct(distinctHosts, srcKey, dstKey)) {
+            srcAnomalies |= ANOMALY_HOST_SWEEP;
+        }
+
+        // syn flood (syns per destination, spoofed sources spread over the sketch)
+        if (ne->isTCPSYN && addCount(synCounts, dstKey) > SYN_FLOOD_THRESHOLD) {
+            dstAnomalies |= ANOMALY_SYN_FLOOD;
+        }
+    }
+
+    uint32_t AnomalyDetector::addCount(CountMinSketch& sketch, uint64_t key) {
+        uint32_t* current = sketch.counters[generation].data();
+        const uint32_t* previous = sketch.counters[generation ^ 1].data();
+
+        // (double hashing for the rows)
+        uint64_t step = (key >> 32) | 1;
+        uint32_t estimate = UINT32_MAX;
+        for (unsigned int row = 0; row < DEPTH; row++) {
+            unsigned int index = row * WIDTH + ((key + row * step) & (WIDTH - 1));
+            if (current[index] < UINT32_MAX) {
+                current[index]++;
+            }
+            estimate = std::min(estimate, current[index] + std::min(previous[index], UINT32_MAX - current[index]));
+        }
+        return estimate;
+    }
+
+    bool AnomalyDetector::addDistinct(DistinctSketch& sketch, uint64_t key, uint64_t item) {
+        uint64_t* current = sketch.cells[generation].data();
+        const uint64_t* previous = sketch.cells[generation ^ 1].data();
+
+        unsigned int bit = item & (CELL_BITS - 1);
+        uint64_t step = (key >> 32) | 1;
+        bool isAboveThreshold = true;
+        for (unsigned int row = 0; row < DEPTH; row++) {
+            unsigned int index = (row * WIDTH + ((key + row * step) & (WIDTH - 1))) * 2;
+            current[index + (bit >> 6)] |= uint64_t(1) << (bit & 63);
+
+            // (collisions only add bits, the row with the most zeros is the best estimate)
+            unsigned int zeros = CELL_BITS - getBitCount(current[index] | previous[index]) - getBitCount(current[index + 1] | previous[index + 1]);
+            if (zeros >= distinctZerosMin) {
+                isAboveThreshold = false;
+            }
+        }
+        return isAboveThreshold;
+    }
+
+    void AnomalyDetector::rotate(long long currentTime) {
+        // (an idle gap longer than a window clears both generations)
+        bool isGap = (currentTime - windowStartTime >= WINDOW_DURATION * 2);
+        generation ^= 1;
+        windowStartTime = currentTime;
+
+        for (int i = 0; i < (isGap ? 2 : 1); i++) {
+            unsigned int g = generation ^ i;
+            std::fill(arpCounts.counters[g].begin(), arpCounts.counters[g].end(), 0);
+            std::fill(synCounts.counters[g].begin(), synCounts.counters[g].end(), 0);
+            std::fill(distinctPorts.cells[g].begin(), distinctPorts.cells[g].end(), 0);
+            std::fill(distinctHosts.cells[g].begin(), distinctHosts.cells[g].end(), 0);
+        }
+    }
+
+    void AnomalyDetector::clear() {
+        windowStartTime = 0;
+        rotate(WINDOW_DURATION * 2);
+        windowStartTime = 0;
+    }
+
+    size_t AnomalyDetector::getMemoryUsage() const {
+        return sizeof(AnomalyDetector) + 2 * DEPTH * WIDTH * (2 * sizeof(uint32_t) + 2 * 2 * sizeof(uint64_t));
+    }
+
+    std::string AnomalyDetector::getAnomaliesString(uint8_t anomalies) {
+        std::string anomaliesString = "";
+        const char* names[] = { "Port scan", "Host sweep", "ARP storm", "SYN flood" };
+        for (int i = 0; i < 4; i++) {
+            if (anomalies & (1 << i)) {
+                anomaliesString += (anomaliesString.empty() ? "" : ", ") + std::string(names[i]);
+            }
+        }
+        return anomaliesString;
+    }
+
+    uint64_t AnomalyDetector::getHash(uint64_t value) {
+        // (splitmix64 finalizer)
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ull;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebull;
+        value ^= value >> 31;
+        return value;
+    }
+
+    uint64_t AnomalyDetector::getKey(const uint8_t* addr, unsigned int addrSize, unsigned int vlanID) {
+        uint64_t key = getHash(vlanID + 1);
+        for (unsigned int i = 0; i < addrSize; i += 8) {
+            uint64_t word = 0;
+            std::memcpy(&word, addr + i, std::min(8u, addrSize - i));
+            key = getHash(key ^ word);
+        }
+        return key;
+    }
+
+    unsigned int AnomalyDetector::getBitCount(uint64_t value) {
+        value = value - ((value >> 1) & 0x5555555555555555ull);
+        value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+        value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return (value * 0x0101010101010101ull) >> 56;
+    }
+
+} // namespace Netvisix
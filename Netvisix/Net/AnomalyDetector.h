@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ANOMALYDETECTOR_H
+#define ANOMALYDETECTOR_H
+
+#include <tins.h>
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    class NetEvent;
+
+    // port scans, host sweeps, arp storms & syn floods from fixed size sketches (no per source state):
+    // count-min sketches for arp frames per source mac & syns per destination, and distinct count sketches
+    // (count-min layout, a 128 bit linear counting bitmap per cell) for ports & hosts contacted per source.
+    // every sketch has two generations rotated each WINDOW_DURATION, estimates cover both (a sliding
+    // window of one to two WINDOW_DURATIONs)
+    class AnomalyDetector {
+
+        public:
+            AnomalyDetector();
+            virtual ~AnomalyDetector();
+
+            // (capture thread, currentTime in ms, monotonic) anomalies of the source and the destination
+            void handleNetEvent(NetEvent* ne, long long currentTime, uint8_t& srcAnomalies, uint8_t& dstAnomalies);
+
+            void clear();
+
+            size_t getMemoryUsage() const;
+
+            // "Port scan, Host sweep"
+            static std::string getAnomaliesString(uint8_t anomalies);
+
+            static const uint8_t ANOMALY_PORT_SCAN = 0x01;
+            static const uint8_t ANOMALY_HOST_SWEEP = 0x02;
+            static const uint8_t ANOMALY_ARP_STORM = 0x04;
+            static const uint8_t ANOMALY_SYN_FLOOD = 0x08;
+
+        private:
+            struct CountMinSketch {
+                // [generation][row * WIDTH + column]
+                std::vector<uint32_t> counters[2];
+            };
+
+            struct DistinctSketch {
+                // [generation][(row * WIDTH + column) * 2 + word]
+                std::vector<uint64_t> cells[2];
+            };
+
+            // (estimate of both generations, min over the rows)
+            uint32_t addCount(CountMinSketch& sketch, uint64_t key);
+            // (true if the distinct count of all rows is above the threshold)
+            bool addDistinct(DistinctSketch& sketch, uint64_t key, uint64_t item);
+
+            void rotate(long long currentTime);
+
+            static uint64_t getHash(uint64_t value);
+            static uint64_t getKey(const uint8_t* addr, unsigned int addrSize, unsigned int vlanID);
+            static unsigned int getBitCount(uint64_t value);
+
+            CountMinSketch arpCounts;
+            CountMinSketch synCounts;
+            DistinctSketch distinctPorts;
+            DistinctSketch distinctHosts;
+
+            unsigned int generation;
+            long long windowStartTime;
+
+            // (zero bits of a cell at the distinct threshold, fewer means more distinct items)
+            unsigned int distinctZerosMin;
+
+            static const unsigned int DEPTH = 4;
+            static const unsigned int WIDTH = 2048;
+            static const unsigned int CELL_BITS = 128;
+
+            static const long long WINDOW_DURATION = 10 * 1000;
+            // (udp from below is an answer of a server)
+            static const uint16_t SYSTEM_PORT_END = 1024;
+
+            static const unsigned int DISTINCT_THRESHOLD = 100;
+            static const uint32_t ARP_STORM_THRESHOLD = 1000;
+            static const uint32_t SYN_FLOOD_THRESHOLD = 5000;
+    };
+
+} // namespace Netvisix
+#endif // ANOMALYDETECTOR_H
@@ -0,0 +1,148 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BindingTable.h"
+#include "Net/NetUtil.h"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace Netvisix {
+
+    BindingTable::BindingTable() {
+        evictedCount = 0;
+    }
+
+    BindingTable::~BindingTable() {
+    }
+
+    void BindingTable::add(const Tins::IPv4Address& ipv4Addr, unsigned int vlanID, const Tins::HWAddress<6>& hwAddr, long long currentTime) {
+        KeyIPv4 key = getKey(ipv4Addr, vlanID);
+        auto it = entriesIPv4.find(key);
+        if (it != entriesIPv4.end()) {
+            it->second.hwAddr = hwAddr;
+            it->second.lastSeenTime = currentTime;
+        }
+        else {
+            if (entriesIPv4.size() >= ENTRIES_MAX) {
+                evictLeastRecentlySeen(entriesIPv4);
+            }
+
+            Entry entry;
+            entry.hwAddr = hwAddr;
+            entry.lastSeenTime = currentTime;
+            entriesIPv4.emplace(key, entry);
+        }
+    }
+
+    void BindingTable::add(const Tins::IPv6Address& ipv6Addr, unsigned int vlanID, const Tins::HWAddress<6>& hwAddr, long long currentTime) {
+        AddrKey key(ipv6Addr, vlanID);
+        auto it = entriesIPv6.find(key);
+        if (it != entriesIPv6.end()) {
+            it->second.hwAddr = hwAddr;
+            it->second.lastSeenTime = currentTime;
+        }
+        else {
+            if (entriesIPv6.size() >= ENTRIES_MAX) {
+                evictLeastRecentlySeen(entriesIPv6);
+            }
+
+            Entry entry;
+            entry.hwAddr = hwAddr;
+            entry.lastSeenTime = currentTime;
+            entriesIPv6.emplace(key, entry);
+        }
+    }
+
+    Tins::HWAddress<6> BindingTable::get(const Tins::IPv4Address& ipv4Addr, unsigned int vlanID) const {
+        auto it = entriesIPv4.find(getKey(ipv4Addr, vlanID));
+        return (it != entriesIPv4.end()) ? it->second.hwAddr : NetUtil::zeroAddrHW;
+    }
+
+    Tins::HWAddress<6> BindingTable::get(const Tins::IPv6Address& ipv6Addr, unsigned int vlanID) const {
+        auto it = entriesIPv6.find(AddrKey(ipv6Addr, vlanID));
+        return (it != entriesIPv6.end()) ? it->second.hwAddr : NetUtil::zeroAddrHW;
+    }
+
+    void BindingTable::expire(long long currentTime) {
+        for (auto it = entriesIPv4.begin(); it != entriesIPv4.end();) {
+            if (currentTime - it->second.lastSeenTime >= BINDING_TIMEOUT) {
+                it = entriesIPv4.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        for (auto it = entriesIPv6.begin(); it != entriesIPv6.end();) {
+            if (currentTime - it->second.lastSeenTime >= BINDING_TIMEOUT) {
+                it = entriesIPv6.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    void BindingTable::clear() {
+        entriesIPv4.clear();
+        entriesIPv6.clear();
+        evictedCount = 0;
+    }
+
+    size_t BindingTable::getMemoryUsage() const {
+        // (node: key, entry, next pointer & cached hash, plus one bucket pointer)
+        return sizeof(BindingTable)
+                + entriesIPv4.size() * (sizeof(KeyIPv4) + sizeof(Entry) + sizeof(void*) * 2)
+                + entriesIPv6.size() * (sizeof(AddrKey) + sizeof(Entry) + sizeof(void*) * 2)
+                + (entriesIPv4.bucket_count() + entriesIPv6.bucket_count()) * sizeof(void*);
+    }
+
+    template <typename Map>
+    void BindingTable::evictLeastRecentlySeen(Map& entries) {
+        // (a batch per full table, the scan costs O(1) per learned binding on average)
+        std::vector<long long> lastSeenTimes;
+        lastSeenTimes.reserve(entries.size());
+        for (const auto& entry : entries) {
+            lastSeenTimes.push_back(entry.second.lastSeenTime);
+        }
+
+        size_t evictCount = std::max<size_t>(1, entries.size() / EVICT_DIVISOR);
+        std::nth_element(lastSeenTimes.begin(), lastSeenTimes.begin() + (evictCount - 1), lastSeenTimes.end());
+        long long lastSeenTimeMax = lastSeenTimes[evictCount - 1];
+
+        size_t evicted = 0;
+        for (auto it = entries.begin(); it != entries.end() && evicted < evictCount;) {
+            if (it->second.lastSeenTime <= lastSeenTimeMax) {
+                it = entries.erase(it);
+                evicted++;
+            }
+            else {
+                ++it;
+            }
+        }
+        evictedCount += evicted;
+    }
+
+    BindingTable::KeyIPv4 BindingTable::getKey(const Tins::IPv4Address& ipv4Addr, unsigned int vlanID) {
+        return ((uint64_t) vlanID << 32) | (uint32_t) ipv4Addr;
+    }
+
+} // namespace Netvisix
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BINDINGTABLE_H
+#define BINDINGTABLE_H
+
+#include "Net/AddrKey.h"
+
+#include <tins.h>
+
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // passive ip -> mac bindings per vlan, learned from arp senders and ndp link-layer address options
+    // (proof that the address is on link, entries expire BINDING_TIMEOUT after they were last seen,
+    // a full table evicts its least recently seen entries)
+    class BindingTable {
+
+        public:
+            BindingTable();
+            virtual ~BindingTable();
+
+            // (currentTime in ms, monotonic)
+            void add(const Tins::IPv4Address& ipv4Addr, unsigned int vlanID, const Tins::HWAddress<6>& hwAddr, long long currentTime);
+            void add(const Tins::IPv6Address& ipv6Addr, unsigned int vlanID, const Tins::HWAddress<6>& hwAddr, long long currentTime);
+
+            // bound mac or the zero address
+            Tins::HWAddress<6> get(const Tins::IPv4Address& ipv4Addr, unsigned int vlanID) const;
+            Tins::HWAddress<6> get(const Tins::IPv6Address& ipv6Addr, unsigned int vlanID) const;
+
+            void expire(long long currentTime);
+
+            void clear();
+
+            size_t getCount() const { return this->entriesIPv4.size() + this->entriesIPv6.size(); }
+            unsigned long getEvictedCount() const { return this->evictedCount; }
+            size_t getMemoryUsage() const;
+
+        private:
+            struct Entry {
+                Tins::HWAddress<6> hwAddr;
+                long long lastSeenTime;
+            };
+
+            // (vlan << 32 | address)
+            typedef uint64_t KeyIPv4;
+
+            static KeyIPv4 getKey(const Tins::IPv4Address& ipv4Addr, unsigned int vlanID);
+
+            // removes the least recently seen 1 / EVICT_DIVISOR of the entries
+            template <typename Map>
+            void evictLeastRecentlySeen(Map& entries);
+
+            std::unordered_map<KeyIPv4, Entry> entriesIPv4;
+            std::unordered_map<AddrKey, Entry, AddrKeyHash> entriesIPv6;
+
+            unsigned long evictedCount;
+
+            static const long long BINDING_TIMEOUT = 60 * 60 * 1000;
+            static const size_t ENTRIES_MAX = 65536;
+            static const size_t EVICT_DIVISOR = 8;
+    };
+
+} // namespace Netvisix
+#endif // BINDINGTABLE_H
@@ -0,0 +1,157 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DHCPParser.h"
+
+#include <cstring>
+
+
+namespace Netvisix {
+
+    void DHCPParser::parseMessage(const uint8_t* data, size_t size, DNSParser::AnswerHandler handler, void* context) {
+        if (size < OPTIONS_OFFSET || data[MAGIC_COOKIE_OFFSET] != 99 || data[MAGIC_COOKIE_OFFSET + 1] != 130
+                || data[MAGIC_COOKIE_OFFSET + 2] != 83 || data[MAGIC_COOKIE_OFFSET + 3] != 99) {
+            return;
+        }
+
+        // ciaddr, yiaddr
+        const uint8_t* addr = nullptr;
+        const uint8_t zeroAddr[4] = { 0, 0, 0, 0 };
+        if (std::memcmp(data + 12, zeroAddr, 4) != 0) {
+            addr = data + 12;
+        }
+        else if (std::memcmp(data + 16, zeroAddr, 4) != 0) {
+            addr = data + 16;
+        }
+
+        char name[NAME_SIZE_MAX];
+        name[0] = '\0';
+        bool hasFQDN = false;
+        uint32_t ttl = TTL_DEFAULT;
+
+        size_t offset = OPTIONS_OFFSET;
+        while (offset < size && data[offset] != OPTION_END) {
+            uint8_t option = data[offset];
+            if (option == OPTION_PAD) {
+                offset++;
+                continue;
+            }
+            if (offset + 2 > size || offset + 2 + data[offset + 1] > size) {
+                return;
+            }
+
+            const uint8_t* value = data + offset + 2;
+            unsigned int length = data[offset + 1];
+
+            if (option == OPTION_HOST_NAME && hasFQDN == false && length > 0 && length < NAME_SIZE_MAX) {
+                std::memcpy(name, value, length);
+                name[length] = '\0';
+            }
+            // flags, rcode1, rcode2, name (ascii or wire format if the E flag is set)
+            else if (option == OPTION_CLIENT_FQDN && length > 3) {
+                bool isWireFormat = (value[0] & 0x04) != 0;
+                unsigned int nameLength = 0;
+                for (unsigned int i = 3; i < length && nameLength + 2 < NAME_SIZE_MAX;) {
+                    if (isWireFormat) {
+                        unsigned int labelLength = value[i];
+                        if (labelLength == 0 || (labelLength & 0xc0) != 0 || i + 1 + labelLength > length
+                                || nameLength + labelLength + 2 >= NAME_SIZE_MAX) {
+                            break;
+                        }
+                        if (nameLength > 0) {
+                            name[nameLength++] = '.';
+                        }
+                        std::memcpy(name + nameLength, value + i + 1, labelLength);
+                        nameLength += labelLength;
+                        i += 1 + labelLength;
+                    }
+                    else {
+                        name[nameLength++] = value[i++];
+                    }
+                }
+                if (nameLength > 0) {
+                    name[nameLength] = '\0';
+                    hasFQDN = true;
+                }
+            }
+            else if (option == OPTION_REQUESTED_ADDR && length == 4 && addr == nullptr) {
+                addr = value;
+            }
+            else if (option == OPTION_LEASE_TIME && length == 4) {
+                ttl = ((uint32_t) value[0] << 24) | (value[1] << 16) | (value[2] << 8) | value[3];
+            }
+
+            offset += 2 + length;
+        }
+
+        // (names may carry a trailing dot or nul)
+        size_t nameLength = std::strlen(name);
+        while (nameLength > 0 && (name[nameLength - 1] == '.' || name[nameLength - 1] == ' ')) {
+            name[--nameLength] = '\0';
+        }
+
+        if (addr != nullptr && nameLength > 0) {
+            handler(context, addr, 4, name, ttl);
+        }
+    }
+
+    bool DHCPParser::getClientBinding(const uint8_t* data, size_t size, uint8_t* hwAddr, uint8_t* ipv4Addr) {
+        if (size < OPTIONS_OFFSET || data[MAGIC_COOKIE_OFFSET] != 99 || data[MAGIC_COOKIE_OFFSET + 1] != 130
+                || data[MAGIC_COOKIE_OFFSET + 2] != 83 || data[MAGIC_COOKIE_OFFSET + 3] != 99) {
+            return false;
+        }
+
+        // htype ethernet, hlen 6, no giaddr
+        const uint8_t zeroAddr[4] = { 0, 0, 0, 0 };
+        if (data[1] != 1 || data[2] != 6 || std::memcmp(data + 24, zeroAddr, 4) != 0) {
+            return false;
+        }
+
+        const uint8_t* addr = nullptr;
+        if (data[0] == OP_REQUEST && std::memcmp(data + 12, zeroAddr, 4) != 0) {
+            addr = data + 12;
+        }
+        else if (data[0] == OP_REPLY && std::memcmp(data + 16, zeroAddr, 4) != 0) {
+            // (offers are not assigned yet)
+            size_t offset = OPTIONS_OFFSET;
+            while (offset + 2 <= size && data[offset] != OPTION_END) {
+                if (data[offset] == OPTION_PAD) {
+                    offset++;
+                    continue;
+                }
+                if (data[offset] == OPTION_MESSAGE_TYPE && data[offset + 1] == 1 && offset + 3 <= size) {
+                    if (data[offset + 2] == MESSAGE_TYPE_ACK) {
+                        addr = data + 16;
+                    }
+                    break;
+                }
+                offset += 2 + data[offset + 1];
+            }
+        }
+
+        if (addr == nullptr) {
+            return false;
+        }
+
+        std::memcpy(hwAddr, data + 28, 6);
+        std::memcpy(ipv4Addr, addr, 4);
+        return true;
+    }
+
+} // namespace Netvisix
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DHCPPARSER_H
+#define DHCPPARSER_H
+
+#include "Net/DNSParser.h"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // client hostnames of dhcp messages (option 12 host name, option 81 client fqdn), paired with the
+    // client address (ciaddr, requested address or the address assigned by the server)
+    class DHCPParser {
+
+        public:
+            static void parseMessage(const uint8_t* data, size_t size, DNSParser::AnswerHandler handler, void* context);
+
+            // client mac (chaddr) and the address it holds: ciaddr of client messages or yiaddr of an ack,
+            // not for relayed messages (the client is on another link then)
+            static bool getClientBinding(const uint8_t* data, size_t size, uint8_t* hwAddr, uint8_t* ipv4Addr);
+
+        private:
+            static const unsigned int OPTIONS_OFFSET = 240;
+            static const unsigned int MAGIC_COOKIE_OFFSET = 236;
+            static const unsigned int NAME_SIZE_MAX = 256;
+
+            static const uint8_t OPTION_PAD = 0;
+            static const uint8_t OPTION_HOST_NAME = 12;
+            static const uint8_t OPTION_REQUESTED_ADDR = 50;
+            static const uint8_t OPTION_LEASE_TIME = 51;
+            static const uint8_t OPTION_MESSAGE_TYPE = 53;
+            static const uint8_t OPTION_CLIENT_FQDN = 81;
+            static const uint8_t OPTION_END = 255;
+
+            static const uint8_t OP_REQUEST = 1;
+            static const uint8_t OP_REPLY = 2;
+            static const uint8_t MESSAGE_TYPE_ACK = 5;
+
+            // (no lease time in client messages)
+            static const uint32_t TTL_DEFAULT = 60 * 60;
+    };
+
+} // namespace Netvisix
+#endif // DHCPPARSER_H
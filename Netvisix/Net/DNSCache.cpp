@@ -0,0 +1,132 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DNSCache.h"
+
+#include <algorithm>
+
+
+namespace Netvisix {
+
+    DNSCache::DNSCache() {
+        wheel.resize(WHEEL_SLOTS);
+        wheelTime = -1;
+    }
+
+    DNSCache::~DNSCache() {
+    }
+
+    void DNSCache::add(const AddrKey& key, const std::string& hostname, uint32_t ttl, long long currentTime) {
+        if (hostname.empty()) {
+            return;
+        }
+
+        if (ttl < TTL_MIN) {
+            ttl = TTL_MIN;
+        }
+        else if (ttl > TTL_MAX) {
+            ttl = TTL_MAX;
+        }
+        long long expiryTime = currentTime + (long long) ttl * 1000;
+
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            it->second.hostname = hostname;
+            // (the wheel key of a shorter expiry is skipped when its slot comes up)
+            if (expiryTime <= it->second.expiryTime) {
+                return;
+            }
+            it->second.expiryTime = expiryTime;
+        }
+        else {
+            Entry entry;
+            entry.hostname = hostname;
+            entry.expiryTime = expiryTime;
+            entries.emplace(key, entry);
+        }
+
+        wheel[(expiryTime / 1000) % WHEEL_SLOTS].push_back(key);
+    }
+
+    void DNSCache::remove(const AddrKey& key, const std::string& hostname) {
+        // (the wheel key becomes stale)
+        auto it = entries.find(key);
+        if (it != entries.end() && it->second.hostname == hostname) {
+            entries.erase(it);
+        }
+    }
+
+    std::string DNSCache::get(const AddrKey& key) const {
+        auto it = entries.find(key);
+        return (it != entries.end()) ? it->second.hostname : "";
+    }
+
+    void DNSCache::expire(long long currentTime) {
+        long long currentSecond = currentTime / 1000;
+        if (wheelTime < 0) {
+            wheelTime = currentSecond;
+            return;
+        }
+
+        // visit every slot passed since the last call (at most one turn)
+        long long firstSecond = std::max(wheelTime + 1, currentSecond - (long long) WHEEL_SLOTS + 1);
+        for (long long second = firstSecond; second <= currentSecond; second++) {
+            std::vector<AddrKey>& slot = wheel[second % WHEEL_SLOTS];
+
+            for (size_t i = 0; i < slot.size();) {
+                auto it = entries.find(slot[i]);
+                bool isStale = (it == entries.end() || (it->second.expiryTime / 1000) % WHEEL_SLOTS != second % WHEEL_SLOTS);
+
+                if (isStale == false && it->second.expiryTime > currentTime) {
+                    // (later turn)
+                    i++;
+                    continue;
+                }
+
+                if (isStale == false) {
+                    entries.erase(it);
+                }
+                slot[i] = slot.back();
+                slot.pop_back();
+            }
+        }
+
+        wheelTime = std::max(wheelTime, currentSecond);
+    }
+
+    void DNSCache::clear() {
+        entries.clear();
+        for (auto& slot : wheel) {
+            slot.clear();
+        }
+        wheelTime = -1;
+    }
+
+    size_t DNSCache::getMemoryUsage() const {
+        size_t memoryUsage = sizeof(DNSCache) + entries.bucket_count() * sizeof(void*);
+        for (const auto& entry : entries) {
+            memoryUsage += sizeof(entry) + entry.second.hostname.capacity();
+        }
+        for (const auto& slot : wheel) {
+            memoryUsage += slot.capacity() * sizeof(AddrKey);
+        }
+        return memoryUsage;
+    }
+
+} // namespace Netvisix
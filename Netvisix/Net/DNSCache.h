@@ -0,0 +1,76 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DNSCACHE_H
+#define DNSCACHE_H
+
+#include "Net/AddrKey.h"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // ip address -> hostname from observed dns answers, entries expire after the record ttl
+    // (timer wheel with one second slots, entries beyond one turn wait for the next turns)
+    class DNSCache {
+
+        public:
+            DNSCache();
+            virtual ~DNSCache();
+
+            // (currentTime in ms, monotonic)
+            void add(const AddrKey& key, const std::string& hostname, uint32_t ttl, long long currentTime);
+
+            // (only if the address is still bound to the hostname)
+            void remove(const AddrKey& key, const std::string& hostname);
+
+            // hostname or "" (expired entries are removed by expire())
+            std::string get(const AddrKey& key) const;
+
+            void expire(long long currentTime);
+
+            void clear();
+
+            size_t getCount() const { return this->entries.size(); }
+            size_t getMemoryUsage() const;
+
+        private:
+            struct Entry {
+                std::string hostname;
+                long long expiryTime;
+            };
+
+            std::unordered_map<AddrKey, Entry, AddrKeyHash> entries;
+
+            // (slot = expiry second % WHEEL_SLOTS, keys may be stale after a refresh)
+            std::vector<std::vector<AddrKey>> wheel;
+            long long wheelTime;
+
+            static const unsigned int WHEEL_SLOTS = 256;
+            static const uint32_t TTL_MIN = 5;
+            static const uint32_t TTL_MAX = 60 * 60;
+    };
+
+} // namespace Netvisix
+#endif // DNSCACHE_H
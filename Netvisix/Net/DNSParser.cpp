@@ -0,0 +1,346 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DNSParser.h"
+
+
+namespace Netvisix {
+
+    void DNSParser::parseMessage(const uint8_t* data, size_t size, AnswerHandler handler, void* context) {
+        if (size < HEADER_SIZE || size > 0xffff) {
+            return;
+        }
+
+        // responses with answers only (queries are the majority and leave here)
+        uint16_t flags = read16(data + 2);
+        bool isResponse = (flags & 0x8000) != 0;
+        unsigned int rcode = flags & 0x000f;
+        unsigned int answerCount = read16(data + 6);
+        if (isResponse == false || rcode != 0 || answerCount == 0) {
+            return;
+        }
+
+        int offset = skipQuestions(data, size);
+        if (offset < 0) {
+            return;
+        }
+
+        // answer, authority & additional section (glue / mdns address records)
+        unsigned int resourceCount = answerCount + read16(data + 8) + read16(data + 10);
+        Record records[RECORDS_MAX];
+        unsigned int recordCount = 0;
+        for (unsigned int i = 0; i < resourceCount && recordCount < RECORDS_MAX; i++) {
+            int nameOffset = offset;
+            offset = skipName(data, size, offset);
+            if (offset < 0 || offset + 10 > (int) size) {
+                return;
+            }
+
+            Record& record = records[recordCount];
+            record.type = read16(data + offset);
+            record.ttl = read32(data + offset + 4);
+            record.dataLength = read16(data + offset + 8);
+            record.nameOffset = nameOffset;
+            record.dataOffset = offset + 10;
+
+            offset += 10 + record.dataLength;
+            if (offset > (int) size) {
+                return;
+            }
+
+            // (mdns: top bit is the cache flush flag)
+            uint16_t recordClass = read16(data + record.dataOffset - 8) & 0x7fff;
+            if (recordClass == 1 && (record.type == TYPE_A || record.type == TYPE_AAAA || record.type == TYPE_CNAME)) {
+                recordCount++;
+            }
+        }
+
+        for (unsigned int i = 0; i < recordCount; i++) {
+            const Record& record = records[i];
+            if ((record.type == TYPE_A && record.dataLength != 4) || (record.type == TYPE_AAAA && record.dataLength != 16)
+                    || record.type == TYPE_CNAME) {
+                continue;
+            }
+
+            // walk the cname chain backwards to the queried alias
+            size_t ownerOffset = record.nameOffset;
+            for (unsigned int depth = 0; depth < CNAME_DEPTH_MAX; depth++) {
+                bool found = false;
+                for (unsigned int j = 0; j < recordCount; j++) {
+                    if (records[j].type == TYPE_CNAME && records[j].nameOffset != ownerOffset
+                            && getIsNameEqual(data, size, records[j].dataOffset, ownerOffset)) {
+                        ownerOffset = records[j].nameOffset;
+                        found = true;
+                        break;
+                    }
+                }
+                if (found == false) {
+                    break;
+                }
+            }
+
+            char name[NAME_SIZE_MAX];
+            if (decodeName(data, size, ownerOffset, name, NAME_SIZE_MAX)) {
+                handler(context, data + record.dataOffset, record.dataLength, name, record.ttl);
+            }
+        }
+    }
+
+    void DNSParser::parseNBNSMessage(const uint8_t* data, size_t size, AnswerHandler handler, ReleaseHandler releaseHandler, void* context) {
+        if (size < HEADER_SIZE) {
+            return;
+        }
+
+        // positive query responses, registrations / refreshes and releases (the name is in the additional record),
+        // not the queries, wack and redirect messages
+        uint16_t flags = read16(data + 2);
+        bool isResponse = (flags & 0x8000) != 0;
+        unsigned int opcode = (flags >> 11) & 0x000f;
+        unsigned int rcode = flags & 0x000f;
+        unsigned int resourceCount = read16(data + 6) + read16(data + 8) + read16(data + 10);
+        if (rcode != 0 || resourceCount == 0) {
+            return;
+        }
+
+        bool isRelease = (opcode == NBNS_OPCODE_RELEASE);
+        if ((opcode == NBNS_OPCODE_QUERY && isResponse) == false && opcode != NBNS_OPCODE_REGISTRATION
+                && opcode != NBNS_OPCODE_REFRESH && opcode != NBNS_OPCODE_REFRESH_ALT && isRelease == false) {
+            return;
+        }
+
+        int offset = skipQuestions(data, size);
+        if (offset < 0) {
+            return;
+        }
+
+        for (unsigned int i = 0; i < resourceCount; i++) {
+            size_t nameOffset = offset;
+            offset = skipName(data, size, offset);
+            if (offset < 0 || offset + 10 > (int) size) {
+                return;
+            }
+
+            uint16_t type = read16(data + offset);
+            uint32_t ttl = read32(data + offset + 4);
+            unsigned int dataLength = read16(data + offset + 8);
+            size_t dataOffset = offset + 10;
+            offset += 10 + dataLength;
+            if (offset > (int) size) {
+                return;
+            }
+
+            char name[NBNS_NAME_LENGTH + 1];
+            if (type != TYPE_NB || decodeNBNSName(data, size, nameOffset, name) == false) {
+                continue;
+            }
+
+            // entries: nb flags (group bit), ipv4 address
+            for (size_t entry = dataOffset; entry + 6 <= dataOffset + dataLength; entry += 6) {
+                bool isGroupName = (read16(data + entry) & 0x8000) != 0;
+                if (isGroupName) {
+                    continue;
+                }
+
+                if (isRelease) {
+                    releaseHandler(context, data + entry + 2, 4, name);
+                }
+                else {
+                    handler(context, data + entry + 2, 4, name, ttl);
+                }
+            }
+        }
+    }
+
+    void DNSParser::parseTCPSegment(const uint8_t* data, size_t size, AnswerHandler handler, void* context) {
+        size_t offset = 0;
+        while (offset + 2 <= size) {
+            size_t messageLength = read16(data + offset);
+            if (messageLength == 0 || offset + 2 + messageLength > size) {
+                return;
+            }
+
+            parseMessage(data + offset + 2, messageLength, handler, context);
+            offset += 2 + messageLength;
+        }
+    }
+
+    int DNSParser::skipQuestions(const uint8_t* data, size_t size) {
+        unsigned int questionCount = read16(data + 4);
+
+        int offset = HEADER_SIZE;
+        for (unsigned int i = 0; i < questionCount; i++) {
+            offset = skipName(data, size, offset);
+            if (offset < 0 || offset + 4 > (int) size) {
+                return -1;
+            }
+            offset += 4;
+        }
+
+        return offset;
+    }
+
+    bool DNSParser::decodeNBNSName(const uint8_t* data, size_t size, size_t offset, char* name) {
+        unsigned int jumps = 0;
+        uint8_t labelLength;
+        if (readLabel(data, size, offset, jumps, labelLength) == false || labelLength != NBNS_NAME_LENGTH * 2) {
+            return false;
+        }
+
+        // first level encoding: two characters 'A'..'P' per byte
+        uint8_t decoded[NBNS_NAME_LENGTH];
+        const uint8_t* encoded = data + offset + 1;
+        for (unsigned int i = 0; i < NBNS_NAME_LENGTH; i++) {
+            uint8_t high = encoded[i * 2] - 'A';
+            uint8_t low = encoded[i * 2 + 1] - 'A';
+            if (high > 15 || low > 15) {
+                return false;
+            }
+            decoded[i] = (high << 4) | low;
+        }
+
+        // last byte is the service suffix (workstation / file server names only)
+        uint8_t suffix = decoded[NBNS_NAME_LENGTH - 1];
+        if (suffix != 0x00 && suffix != 0x20) {
+            return false;
+        }
+
+        unsigned int nameLength = NBNS_NAME_LENGTH - 1;
+        while (nameLength > 0 && decoded[nameLength - 1] == ' ') {
+            nameLength--;
+        }
+        for (unsigned int i = 0; i < nameLength; i++) {
+            if (decoded[i] < 0x20 || decoded[i] > 0x7e) {
+                return false;
+            }
+            name[i] = decoded[i];
+        }
+        name[nameLength] = '\0';
+
+        return nameLength > 0;
+    }
+
+    bool DNSParser::readLabel(const uint8_t* data, size_t size, size_t& offset, unsigned int& jumps, uint8_t& labelLength) {
+        while (true) {
+            if (offset >= size) {
+                return false;
+            }
+
+            uint8_t length = data[offset];
+            // compression pointer
+            if ((length & 0xc0) == 0xc0) {
+                if (offset + 1 >= size || ++jumps > JUMPS_MAX) {
+                    return false;
+                }
+                offset = ((length & 0x3f) << 8) | data[offset + 1];
+                continue;
+            }
+            if ((length & 0xc0) != 0 || offset + 1 + length > size) {
+                return false;
+            }
+
+            labelLength = length;
+            return true;
+        }
+    }
+
+    int DNSParser::skipName(const uint8_t* data, size_t size, size_t offset) {
+        while (offset < size) {
+            uint8_t length = data[offset];
+            if (length == 0) {
+                return offset + 1;
+            }
+            if ((length & 0xc0) == 0xc0) {
+                return (offset + 2 <= size) ? (int) offset + 2 : -1;
+            }
+            if ((length & 0xc0) != 0) {
+                return -1;
+            }
+            offset += 1 + length;
+        }
+
+        return -1;
+    }
+
+    bool DNSParser::decodeName(const uint8_t* data, size_t size, size_t offset, char* name, size_t nameSize) {
+        size_t nameLength = 0;
+        unsigned int jumps = 0;
+
+        while (true) {
+            uint8_t labelLength;
+            if (readLabel(data, size, offset, jumps, labelLength) == false) {
+                return false;
+            }
+            if (labelLength == 0) {
+                break;
+            }
+
+            if (nameLength + labelLength + 2 > nameSize) {
+                return false;
+            }
+            if (nameLength > 0) {
+                name[nameLength++] = '.';
+            }
+            for (unsigned int i = 0; i < labelLength; i++) {
+                name[nameLength++] = data[offset + 1 + i];
+            }
+            offset += 1 + labelLength;
+        }
+
+        name[nameLength] = '\0';
+        return nameLength > 0;
+    }
+
+    bool DNSParser::getIsNameEqual(const uint8_t* data, size_t size, size_t offsetA, size_t offsetB) {
+        unsigned int jumpsA = 0;
+        unsigned int jumpsB = 0;
+
+        while (true) {
+            uint8_t lengthA;
+            uint8_t lengthB;
+            if (readLabel(data, size, offsetA, jumpsA, lengthA) == false || readLabel(data, size, offsetB, jumpsB, lengthB) == false) {
+                return false;
+            }
+            if (lengthA != lengthB) {
+                return false;
+            }
+            if (lengthA == 0) {
+                return true;
+            }
+
+            // (case insensitive)
+            for (unsigned int i = 1; i <= lengthA; i++) {
+                uint8_t a = data[offsetA + i];
+                uint8_t b = data[offsetB + i];
+                if (a >= 'A' && a <= 'Z') {
+                    a += 'a' - 'A';
+                }
+                if (b >= 'A' && b <= 'Z') {
+                    b += 'a' - 'A';
+                }
+                if (a != b) {
+                    return false;
+                }
+            }
+
+            offsetA += 1 + lengthA;
+            offsetB += 1 + lengthB;
+        }
+    }
+
+} // namespace Netvisix
@@ -0,0 +1,90 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DNSPARSER_H
+#define DNSPARSER_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // dns response parser working on the raw payload (no copies, no heap allocations),
+    // reports A / AAAA answers with the owner name resolved back through cname chains
+    // (same message format: mdns, llmnr and, with its own name encoding, netbios name service)
+    class DNSParser {
+
+        public:
+            // addr: 4 (A) or 16 (AAAA) bytes in network byte order, context as passed to the parser
+            typedef void (*AnswerHandler)(void* context, const uint8_t* addr, unsigned int addrLength, const char* name, uint32_t ttl);
+            // the name is no longer bound to the address
+            typedef void (*ReleaseHandler)(void* context, const uint8_t* addr, unsigned int addrLength, const char* name);
+
+            static void parseMessage(const uint8_t* data, size_t size, AnswerHandler handler, void* context);
+
+            // dns over tcp: length prefixed messages, only complete messages of the segment are parsed
+            static void parseTCPSegment(const uint8_t* data, size_t size, AnswerHandler handler, void* context);
+
+            // netbios name service: query responses, registrations / refreshes and releases, unique names only
+            static void parseNBNSMessage(const uint8_t* data, size_t size, AnswerHandler handler, ReleaseHandler releaseHandler, void* context);
+
+        private:
+            struct Record {
+                uint16_t type;
+                uint16_t nameOffset;
+                uint16_t dataOffset;
+                uint16_t dataLength;
+                uint32_t ttl;
+            };
+
+            // offset behind the name / the question section or -1
+            static int skipName(const uint8_t* data, size_t size, size_t offset);
+            static int skipQuestions(const uint8_t* data, size_t size);
+            static bool decodeName(const uint8_t* data, size_t size, size_t offset, char* name, size_t nameSize);
+            static bool getIsNameEqual(const uint8_t* data, size_t size, size_t offsetA, size_t offsetB);
+            static bool decodeNBNSName(const uint8_t* data, size_t size, size_t offset, char* name);
+
+            // next label (follows compression pointers), length 0 at the end of the name, false if malformed
+            static bool readLabel(const uint8_t* data, size_t size, size_t& offset, unsigned int& jumps, uint8_t& labelLength);
+
+            static uint16_t read16(const uint8_t* data) { return (data[0] << 8) | data[1]; }
+            static uint32_t read32(const uint8_t* data) { return ((uint32_t) read16(data) << 16) | read16(data + 2); }
+
+            static const uint16_t TYPE_A = 1;
+            static const uint16_t TYPE_CNAME = 5;
+            static const uint16_t TYPE_AAAA = 28;
+            static const uint16_t TYPE_NB = 32;
+
+            static const unsigned int HEADER_SIZE = 12;
+            static const unsigned int RECORDS_MAX = 64;
+            static const unsigned int CNAME_DEPTH_MAX = 8;
+            static const unsigned int JUMPS_MAX = 16;
+            static const unsigned int NAME_SIZE_MAX = 256;
+            static const unsigned int NBNS_NAME_LENGTH = 16;
+
+            static const unsigned int NBNS_OPCODE_QUERY = 0;
+            static const unsigned int NBNS_OPCODE_REGISTRATION = 5;
+            static const unsigned int NBNS_OPCODE_RELEASE = 6;
+            static const unsigned int NBNS_OPCODE_REFRESH = 8;
+            static const unsigned int NBNS_OPCODE_REFRESH_ALT = 9;
+    };
+
+} // namespace Netvisix
+#endif // DNSPARSER_H
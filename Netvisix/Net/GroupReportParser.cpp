@@ -0,0 +1,131 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GroupReportParser.h"
+
+#include <cstring>
+
+
+namespace Netvisix {
+
+    void GroupReportParser::parseIGMP(const uint8_t* data, size_t size, std::vector<GroupReport>& reports) {
+        if (size < 8) {
+            return;
+        }
+
+        // type, max resp time, checksum, group (v3: reserved, record count, records)
+        switch (data[0]) {
+            case IGMP_V1_REPORT:
+            case IGMP_V2_REPORT:
+                addReport(data + 4, 4, true, reports);
+                break;
+            case IGMP_V2_LEAVE:
+                addReport(data + 4, 4, false, reports);
+                break;
+            case IGMP_V3_REPORT:
+                parseGroupRecords(data + 8, size - 8, (data[6] << 8) | data[7], 4, reports);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void GroupReportParser::parseMLD(const uint8_t* data, size_t size, std::vector<GroupReport>& reports) {
+        if (size < 8) {
+            return;
+        }
+
+        // type, code, checksum, max resp delay, reserved, group (v2: reserved, record count, records)
+        switch (data[0]) {
+            case MLD_V1_REPORT:
+            case MLD_V1_DONE:
+                if (size >= 24) {
+                    addReport(data + 8, 16, data[0] == MLD_V1_REPORT, reports);
+                }
+                break;
+            case MLD_V2_REPORT:
+                parseGroupRecords(data + 8, size - 8, (data[6] << 8) | data[7], 16, reports);
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool GroupReportParser::getIsMLDReport(uint8_t icmpv6Type) {
+        return icmpv6Type == MLD_V1_REPORT || icmpv6Type == MLD_V1_DONE || icmpv6Type == MLD_V2_REPORT;
+    }
+
+    void GroupReportParser::parseGroupRecords(const uint8_t* data, size_t size, unsigned int recordCount, unsigned int addrSize,
+                                              std::vector<GroupReport>& reports) {
+        // record type, aux data length (32 bit words), source count, group, sources, aux data
+        size_t offset = 0;
+        for (unsigned int i = 0; i < recordCount && offset + 4 + addrSize <= size; i++) {
+            uint8_t recordType = data[offset];
+            unsigned int sourceCount = (data[offset + 2] << 8) | data[offset + 3];
+            size_t recordSize = 4 + addrSize + sourceCount * addrSize + data[offset + 1] * 4;
+            if (offset + recordSize > size) {
+                return;
+            }
+
+            addGroupRecord(recordType, sourceCount, data + offset + 4, addrSize, reports);
+            offset += recordSize;
+        }
+    }
+
+    void GroupReportParser::addGroupRecord(uint8_t recordType, unsigned int sourceCount, const uint8_t* group, unsigned int addrSize,
+                                           std::vector<GroupReport>& reports) {
+        // (exclude mode: any source, include mode: the listed ones, include of none is a leave)
+        if (recordType == RECORD_MODE_IS_EXCLUDE || recordType == RECORD_CHANGE_TO_EXCLUDE) {
+            addReport(group, addrSize, true, reports);
+        }
+        else if (recordType == RECORD_MODE_IS_INCLUDE || recordType == RECORD_CHANGE_TO_INCLUDE
+                 || recordType == RECORD_ALLOW_NEW_SOURCES) {
+            if (sourceCount > 0 || recordType != RECORD_ALLOW_NEW_SOURCES) {
+                addReport(group, addrSize, sourceCount > 0, reports);
+            }
+        }
+    }
+
+    void GroupReportParser::addReport(const uint8_t* addr, unsigned int addrSize, bool isJoin, std::vector<GroupReport>& reports) {
+        if (reports.size() >= REPORTS_MAX) {
+            return;
+        }
+
+        uint8_t group[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 0, 0, 0, 0 };
+        if (addrSize == 4) {
+            // (224.0.0.0/4 only)
+            if ((addr[0] & 0xf0) != 0xe0) {
+                return;
+            }
+            std::memcpy(group + 12, addr, 4);
+        }
+        else {
+            if (addr[0] != 0xff) {
+                return;
+            }
+            std::memcpy(group, addr, 16);
+        }
+
+        GroupReport report;
+        report.group = Tins::IPv6Address(group);
+        report.isJoin = isJoin;
+        reports.push_back(report);
+    }
+
+} // namespace Netvisix
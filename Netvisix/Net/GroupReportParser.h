@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GROUPREPORTPARSER_H
+#define GROUPREPORTPARSER_H
+
+#include "Net/NetEvent.h"
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // multicast membership reports: igmp v1/v2/v3 (ip payload) and mld v1/v2 (icmpv6 message),
+    // queries and other messages leave reports untouched
+    class GroupReportParser {
+
+        public:
+            static void parseIGMP(const uint8_t* data, size_t size, std::vector<GroupReport>& reports);
+            static void parseMLD(const uint8_t* data, size_t size, std::vector<GroupReport>& reports);
+
+            // (icmpv6 types worth handing to parseMLD)
+            static bool getIsMLDReport(uint8_t icmpv6Type);
+
+            // one v3 / v2 group record (record type, source count, group of addrSize 4 or 16 bytes)
+            static void addGroupRecord(uint8_t recordType, unsigned int sourceCount, const uint8_t* group, unsigned int addrSize,
+                                       std::vector<GroupReport>& reports);
+
+            static const uint8_t PROTOCOL_IGMP = 2;
+
+        private:
+            // v3 / v2 group records (rfc 3376, rfc 3810), addrSize 4 or 16
+            static void parseGroupRecords(const uint8_t* data, size_t size, unsigned int recordCount, unsigned int addrSize,
+                                          std::vector<GroupReport>& reports);
+            static void addReport(const uint8_t* addr, unsigned int addrSize, bool isJoin, std::vector<GroupReport>& reports);
+
+            static const uint8_t IGMP_V1_REPORT = 0x12;
+            static const uint8_t IGMP_V2_REPORT = 0x16;
+            static const uint8_t IGMP_V2_LEAVE = 0x17;
+            static const uint8_t IGMP_V3_REPORT = 0x22;
+
+            static const uint8_t MLD_V1_REPORT = 131;
+            static const uint8_t MLD_V1_DONE = 132;
+            static const uint8_t MLD_V2_REPORT = 143;
+
+            static const uint8_t RECORD_MODE_IS_INCLUDE = 1;
+            static const uint8_t RECORD_MODE_IS_EXCLUDE = 2;
+            static const uint8_t RECORD_CHANGE_TO_INCLUDE = 3;
+            static const uint8_t RECORD_CHANGE_TO_EXCLUDE = 4;
+            static const uint8_t RECORD_ALLOW_NEW_SOURCES = 5;
+
+            static const unsigned int REPORTS_MAX = 64;
+    };
+
+} // namespace Netvisix
+#endif // GROUPREPORTPARSER_H
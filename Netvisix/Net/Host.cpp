@@ -19,18 +19,33 @@
 
 #include "Host.h"
 #include "Net/NetEventManager.h"
+#include "Net/NetEvent.h"
 #include "Net/NetStatistic.h"
 #include "Net/NetUtil.h"
 
+#include <algorithm>
+
 namespace Netvisix {
 
     Host::Host() {
+        id = 0;
+        vlanID = 0;
+        tunnel = Tunnel::None;
+        tunnelID = 0;
         hostname = "";
         hostnameIsFromReverseDNSLookp = false;
+        hostnameIsFromServerName = false;
 
         addrHW = Tins::HWAddress<6>("00:00:00:00:00:00");
         netArea = NetArea::UNKOWN;
 
+        lastSeenTime = 0;
+
+        anomalies = 0;
+        anomalyTime = 0;
+
+        aggregatePrefixLength = 0;
+
         statistic = new NetStatistic();
     }
 
@@ -43,6 +58,32 @@ namespace Netvisix {
 //        return s;
 //    }
 
+    size_t Host::getMemoryUsage() {
+        return sizeof(Host)
+                + statistic->getMemoryUsage()
+                + addrListIPv4.capacity() * sizeof(Tins::IPv4Address)
+                + addrListIPv6.capacity() * sizeof(Tins::IPv6Address)
+                + hostname.capacity()
+                + tunnelEndpoint.capacity()
+                + openPortsTCP.getMemoryUsage()
+                + openPortsUDP.getMemoryUsage()
+                + sizeof(Host*) * 3 // (lru list node)
+                + aggregateMembersIPv4.size() * (sizeof(Tins::IPv4Address) + sizeof(void*) * 4)
+                + aggregateMembersIPv6.size() * (sizeof(Tins::IPv6Address) + sizeof(void*) * 4);
+    }
+
+    void Host::addAggregateMember(const Tins::IPv4Address& ipv4) {
+        if (getAggregateMemberCount() < AGGREGATE_MEMBERS_MAX) {
+            aggregateMembersIPv4.insert(ipv4);
+        }
+    }
+
+    void Host::addAggregateMember(const Tins::IPv6Address& ipv6) {
+        if (getAggregateMemberCount() < AGGREGATE_MEMBERS_MAX) {
+            aggregateMembersIPv6.insert(ipv6);
+        }
+    }
+
     void Host::setAddrHW(Tins::HWAddress<6> hw, bool update) {
         this->addrHW = hw;
         if (update) {
@@ -50,6 +91,12 @@ namespace Netvisix {
         }
     }
 
+    void Host::setTunnel(Tunnel tunnel, uint32_t tunnelID, const std::string& tunnelEndpoint) {
+        this->tunnel = tunnel;
+        this->tunnelID = tunnelID;
+        this->tunnelEndpoint = tunnelEndpoint;
+    }
+
     void Host::setHostname(const std::string& hostname, bool update) {
         this->hostname = hostname;
         if (update) {
@@ -113,6 +160,50 @@ namespace Netvisix {
         return NetUtil::zeroAddrIPv6;
     }
 
+    void Host::merge(Host* host) {
+        if (addrHW == NetUtil::zeroAddrHW) {
+            addrHW = host->addrHW;
+        }
+        for (const Tins::IPv4Address& ipv4 : host->addrListIPv4) {
+            if (getAddrIPv4(ipv4) == NetUtil::zeroAddrIPv4) {
+                addrListIPv4.push_back(ipv4);
+            }
+        }
+        for (const Tins::IPv6Address& ipv6 : host->addrListIPv6) {
+            if (getAddrIPv6(ipv6) == NetUtil::zeroAddrIPv6) {
+                addrListIPv6.push_back(ipv6);
+            }
+        }
+
+        // (dns / dhcp names before rdns)
+        if (host->hostname.empty() == false
+                && (hostname.empty() || (hostnameIsFromReverseDNSLookp && host->hostnameIsFromReverseDNSLookp == false))) {
+            hostname = host->hostname;
+            hostnameIsFromReverseDNSLookp = host->hostnameIsFromReverseDNSLookp;
+            hostnameIsFromServerName = host->hostnameIsFromServerName;
+        }
+
+        if (tunnel == Tunnel::None) {
+            tunnel = host->tunnel;
+            tunnelID = host->tunnelID;
+            tunnelEndpoint = host->tunnelEndpoint;
+        }
+
+        if (host->lastSeenTime > lastSeenTime) {
+            lastSeenTime = host->lastSeenTime;
+        }
+
+        openPortsTCP.add(host->openPortsTCP);
+        openPortsUDP.add(host->openPortsUDP);
+
+        if (host->anomalies != 0) {
+            anomalies |= host->anomalies;
+            anomalyTime = std::max(anomalyTime, host->anomalyTime);
+        }
+
+        statistic->add(host->statistic);
+    }
+
     void Host::onAddrUpdate() {
         NetEventManager::SharedInstance()->onHostAddrUpdate(this);
     }
@@ -120,6 +211,10 @@ namespace Netvisix {
     std::string Host::getPreferedHostIdentifier() {
         if (hostname.empty() == false) {
             return hostname;
+        } else if (aggregatePrefixLength > 0 && addrListIPv4.empty() == false) {
+            return addrListIPv4.at(0).to_string() + "/" + std::to_string(aggregatePrefixLength);
+        } else if (aggregatePrefixLength > 0 && addrListIPv6.empty() == false) {
+            return addrListIPv6.at(0).to_string() + "/" + std::to_string(aggregatePrefixLength);
         } else if (addrListIPv4.empty() == false) {
             return addrListIPv4.at(0).to_string();
         } else if (addrListIPv6.empty() == false) {
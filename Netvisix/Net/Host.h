@@ -20,12 +20,18 @@
 #ifndef HOST_H
 #define HOST_H
 
+#include "Net/PortSet.h"
+
 #include <tins.h>
 
+#include <list>
+#include <set>
+
 
 namespace Netvisix {
 
     enum class NetArea;
+    enum class Tunnel;
     class NetStatistic;
 
     class Host {
@@ -36,9 +42,22 @@ namespace Netvisix {
 
 //            std::string getDebugString();
 
+            unsigned int getID() { return this->id; }
+            void setID(unsigned int id) { this->id = id; }
+
             void setNetArea(NetArea netArea) { this->netArea = netArea; }
             NetArea getNetArea() { return this->netArea; }
 
+            // (host identity is (vlan, address), see NetEvent::vlanID)
+            unsigned int getVlanID() { return this->vlanID; }
+            void setVlanID(unsigned int vlanID) { this->vlanID = vlanID; }
+
+            // tunnel the host was last seen in and the outer endpoint on its side ("" for mpls)
+            Tunnel getTunnel() { return this->tunnel; }
+            uint32_t getTunnelID() { return this->tunnelID; }
+            const std::string& getTunnelEndpoint() { return this->tunnelEndpoint; }
+            void setTunnel(Tunnel tunnel, uint32_t tunnelID, const std::string& tunnelEndpoint);
+
             void addAddrIPv4(Tins::IPv4Address ipv4, bool update);
             const Tins::IPv4Address& getAddrIPv4(Tins::IPv4Address ipv4) const;
             const Tins::IPv4Address& getAddrIPv4(const std::string& ipv4) const;
@@ -51,29 +70,89 @@ namespace Netvisix {
 
             std::string getPreferedHostIdentifier();
 
+            // takes over addresses, name, tunnel & statistic of another host of the same machine
+            void merge(Host* host);
+
             std::string getHostname() { return hostname; }
             void setHostname(const std::string& hostname, bool update);
 
             bool getHostnameIsFromReverseDNSLookp() { return hostnameIsFromReverseDNSLookp; }
             void setHostnameIsFromReverseDNSLookp(bool fromRDNS) { this->hostnameIsFromReverseDNSLookp = fromRDNS; }
 
+            // (tls sni / http host of a connection to the host)
+            bool getHostnameIsFromServerName() { return hostnameIsFromServerName; }
+            void setHostnameIsFromServerName(bool fromServerName) { this->hostnameIsFromServerName = fromServerName; }
+
             const Tins::HWAddress<6>& getAddrHW() { return addrHW; }
             void setAddrHW(Tins::HWAddress<6> hw, bool update);
 
+            // (steady clock ms, used for idle / lru eviction)
+            long long getLastSeenTime() { return this->lastSeenTime; }
+            void setLastSeenTime(long long lastSeenTime) { this->lastSeenTime = lastSeenTime; }
+
+            std::list<Host*>::iterator getLRUIterator() { return this->lruIterator; }
+            void setLRUIterator(std::list<Host*>::iterator lruIterator) { this->lruIterator = lruIterator; }
+
+            size_t getMemoryUsage();
+
+            // outside subnet prefix aggregation (addr list holds the prefix, 0 = single host)
+            unsigned int getAggregatePrefixLength() { return this->aggregatePrefixLength; }
+            void setAggregatePrefixLength(unsigned int prefixLength) { this->aggregatePrefixLength = prefixLength; }
+            bool getIsAggregate() { return this->aggregatePrefixLength > 0; }
+
+            void addAggregateMember(const Tins::IPv4Address& ipv4);
+            void addAggregateMember(const Tins::IPv6Address& ipv6);
+            const std::set<Tins::IPv4Address>& getAggregateMembersIPv4() const { return aggregateMembersIPv4; }
+            const std::set<Tins::IPv6Address>& getAggregateMembersIPv6() const { return aggregateMembersIPv6; }
+            unsigned int getAggregateMemberCount() { return this->aggregateMembersIPv4.size() + this->aggregateMembersIPv6.size(); }
+
+            // ports the host answered on (see NetEvent::openPortTCP), read through NetEventManager::getOpenPorts
+            PortSet& getOpenPorts(bool isUDP) { return isUDP ? this->openPortsUDP : this->openPortsTCP; }
+
+            // AnomalyDetector::ANOMALY_* flags, cleared by NetEventManager::evictHosts after a hold time
+            uint8_t getAnomalies() { return this->anomalies; }
+            long long getAnomalyTime() { return this->anomalyTime; }
+            void addAnomalies(uint8_t anomalies, long long time) { this->anomalies |= anomalies; this->anomalyTime = time; }
+            void clearAnomalies() { this->anomalies = 0; }
+
             NetStatistic* statistic;
 
         private:
             void onAddrUpdate();
 
+            unsigned int id;
+
             NetArea netArea;
+            unsigned int vlanID;
+
+            Tunnel tunnel;
+            uint32_t tunnelID;
+            std::string tunnelEndpoint;
 
             std::string hostname;
             bool hostnameIsFromReverseDNSLookp;
+            bool hostnameIsFromServerName;
 
             Tins::HWAddress<6> addrHW;
 
             std::vector<Tins::IPv4Address> addrListIPv4;
             std::vector<Tins::IPv6Address> addrListIPv6;
+
+            long long lastSeenTime;
+            std::list<Host*>::iterator lruIterator;
+
+            PortSet openPortsTCP;
+            PortSet openPortsUDP;
+
+            uint8_t anomalies;
+            long long anomalyTime;
+
+            unsigned int aggregatePrefixLength;
+            std::set<Tins::IPv4Address> aggregateMembersIPv4;
+            std::set<Tins::IPv6Address> aggregateMembersIPv6;
+
+            // (members beyond this are still counted in the statistic, but not listed)
+            const unsigned int AGGREGATE_MEMBERS_MAX = 1024;
     };
 
 } // namespace Netvisix
@@ -0,0 +1,147 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "HostChangeTracker.h"
+#include "Host.h"
+#include "Net/NetUtil.h"
+
+
+namespace Netvisix {
+
+    HostChangeTracker::HostChangeTracker() {
+        for (unsigned int i = 0; i < PAGES_MAX; i++) {
+            pages[i].store(nullptr);
+        }
+        hostCount.store(0);
+    }
+
+    HostChangeTracker::~HostChangeTracker() {
+        reset();
+    }
+
+    HostChangeTracker::Page* HostChangeTracker::getPage(unsigned int hostID) {
+        unsigned int pageIndex = hostID / PAGE_SIZE;
+        if (pageIndex >= PAGES_MAX) {
+            return nullptr;
+        }
+
+        Page* page = pages[pageIndex].load(std::memory_order_acquire);
+        if (page == nullptr) {
+            page = new Page();
+            for (unsigned int i = 0; i < PAGE_SIZE; i++) {
+                page->hosts[i].store(nullptr, std::memory_order_relaxed);
+            }
+            for (unsigned int i = 0; i < PAGE_SIZE / WORD_BITS; i++) {
+                page->newBits[i].store(0, std::memory_order_relaxed);
+                page->dirtyBits[i].store(0, std::memory_order_relaxed);
+            }
+            pages[pageIndex].store(page, std::memory_order_release);
+        }
+
+        return page;
+    }
+
+    void HostChangeTracker::addHost(Host* host) {
+        Page* page = getPage(host->getID());
+        if (page == nullptr) {
+            return;
+        }
+
+        unsigned int index = host->getID() % PAGE_SIZE;
+        page->hosts[index].store(host, std::memory_order_relaxed);
+
+        if (host->getID() >= hostCount.load(std::memory_order_relaxed)) {
+            hostCount.store(host->getID() + 1, std::memory_order_release);
+        }
+
+        // (the release publishes the slot to the consumer)
+        page->newBits[index / WORD_BITS].fetch_or(uint64_t(1) << (index % WORD_BITS), std::memory_order_release);
+    }
+
+    void HostChangeTracker::setHostDirty(Host* host) {
+        if (host == nullptr || host->getID() >= hostCount.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        Page* page = pages[host->getID() / PAGE_SIZE].load(std::memory_order_acquire);
+        unsigned int index = host->getID() % PAGE_SIZE;
+        page->dirtyBits[index / WORD_BITS].fetch_or(uint64_t(1) << (index % WORD_BITS), std::memory_order_release);
+    }
+
+    void HostChangeTracker::getNewHosts(std::vector<Host*>& result) {
+        drainBits(true, result);
+    }
+
+    void HostChangeTracker::getDirtyHosts(std::vector<Host*>& result) {
+        drainBits(false, result);
+    }
+
+    void HostChangeTracker::drainBits(bool newBits, std::vector<Host*>& result) {
+        unsigned int count = hostCount.load(std::memory_order_acquire);
+        unsigned int pageCount = (count + PAGE_SIZE - 1) / PAGE_SIZE;
+
+        for (unsigned int p = 0; p < pageCount; p++) {
+            Page* page = pages[p].load(std::memory_order_acquire);
+            if (page == nullptr) {
+                continue;
+            }
+
+            std::atomic<uint64_t>* words = newBits ? page->newBits : page->dirtyBits;
+            for (unsigned int w = 0; w < PAGE_SIZE / WORD_BITS; w++) {
+                if (words[w].load(std::memory_order_relaxed) == 0) {
+                    continue;
+                }
+
+                uint64_t bits = words[w].exchange(0, std::memory_order_acq_rel);
+                while (bits != 0) {
+                    unsigned int bit = NetUtil::getTrailingZeroCount(bits);
+                    bits &= bits - 1;
+
+                    Host* host = page->hosts[w * WORD_BITS + bit].load(std::memory_order_relaxed);
+                    if (host != nullptr) {
+                        result.push_back(host);
+                    }
+                }
+            }
+        }
+    }
+
+    void HostChangeTracker::removeHost(Host* host) {
+        Page* page = pages[host->getID() / PAGE_SIZE].load(std::memory_order_acquire);
+        if (page == nullptr) {
+            return;
+        }
+
+        unsigned int index = host->getID() % PAGE_SIZE;
+        uint64_t mask = ~(uint64_t(1) << (index % WORD_BITS));
+        page->hosts[index].store(nullptr, std::memory_order_relaxed);
+        page->newBits[index / WORD_BITS].fetch_and(mask, std::memory_order_relaxed);
+        page->dirtyBits[index / WORD_BITS].fetch_and(mask, std::memory_order_relaxed);
+    }
+
+    void HostChangeTracker::reset() {
+        for (unsigned int i = 0; i < PAGES_MAX; i++) {
+            Page* page = pages[i].exchange(nullptr);
+            if (page != nullptr) {
+                delete page;
+            }
+        }
+        hostCount.store(0);
+    }
+} // namespace Netvisix
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HOSTCHANGETRACKER_H
+#define HOSTCHANGETRACKER_H
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    class Host;
+
+    // new hosts & dirty hosts as bitsets indexed by host id, written by the capture thread
+    // and drained by one consumer thread (lock-free, pages are never moved)
+    class HostChangeTracker {
+
+        public:
+            HostChangeTracker();
+            virtual ~HostChangeTracker();
+
+            // (capture thread)
+            void addHost(Host* host);
+            void setHostDirty(Host* host);
+
+            // (consumer thread)
+            void getNewHosts(std::vector<Host*>& result);
+            void getDirtyHosts(std::vector<Host*>& result);
+
+            // (only while the capture thread is stopped or blocked)
+            void removeHost(Host* host);
+            void reset();
+
+        private:
+            static const unsigned int PAGE_SIZE = 4096;
+            static const unsigned int PAGES_MAX = 4096;
+            static const unsigned int WORD_BITS = 64;
+
+            struct Page {
+                std::atomic<Host*> hosts[PAGE_SIZE];
+                std::atomic<uint64_t> newBits[PAGE_SIZE / WORD_BITS];
+                std::atomic<uint64_t> dirtyBits[PAGE_SIZE / WORD_BITS];
+            };
+
+            Page* getPage(unsigned int hostID);
+            void drainBits(bool newBits, std::vector<Host*>& result);
+
+            std::atomic<Page*> pages[PAGES_MAX];
+
+            // (highest host id + 1, ids of removed hosts are reused)
+            std::atomic<unsigned int> hostCount;
+    };
+
+} // namespace Netvisix
+#endif // HOSTCHANGETRACKER_H
@@ -0,0 +1,44 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef IHOSTREMOVALLISTENER_H
+#define IHOSTREMOVALLISTENER_H
+
+#include <vector>
+
+
+namespace Netvisix {
+
+    class Host;
+
+    class IHostRemovalListener {
+
+        public:
+            virtual ~IHostRemovalListener() { }
+
+            // (called on the gui thread before the hosts are deleted, capture is blocked meanwhile)
+            virtual void onHostsRemoved(const std::vector<Host*>& hosts) = 0;
+
+            // (same thread & lock, before onHostsRemoved of the merged hosts: their addresses and statistics
+            // are already folded into host)
+            virtual void onHostsMerged(Host* /*host*/, const std::vector<Host*>& /*mergedHosts*/) { }
+    };
+
+} // namespace Netvisix
+#endif // IHOSTREMOVALLISTENER_H
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "IdentityResolver.h"
+
+#include <algorithm>
+
+
+namespace Netvisix {
+
+    IdentityResolver::IdentityResolver() {
+        hasPendingMerges = false;
+    }
+
+    IdentityResolver::~IdentityResolver() {
+    }
+
+    void IdentityResolver::unite(unsigned int idA, unsigned int idB) {
+        unsigned int rootA = find(idA);
+        unsigned int rootB = find(idB);
+        if (rootA == rootB) {
+            return;
+        }
+
+        grow(std::max(rootA, rootB));
+
+        // (the larger set keeps its root, the older host on ties)
+        if (sizes[rootA] < sizes[rootB] || (sizes[rootA] == sizes[rootB] && rootB < rootA)) {
+            std::swap(rootA, rootB);
+        }
+        parents[rootB] = rootA;
+        sizes[rootA] += sizes[rootB];
+        hasPendingMerges = true;
+    }
+
+    unsigned int IdentityResolver::find(unsigned int id) {
+        if (id >= parents.size()) {
+            return id;
+        }
+
+        while (parents[id] != id) {
+            parents[id] = parents[parents[id]];
+            id = parents[id];
+        }
+        return id;
+    }
+
+    void IdentityResolver::grow(unsigned int id) {
+        while (parents.size() <= id) {
+            parents.push_back(parents.size());
+            sizes.push_back(1);
+        }
+    }
+
+    void IdentityResolver::clear() {
+        for (unsigned int i = 0; i < parents.size(); i++) {
+            parents[i] = i;
+            sizes[i] = 1;
+        }
+        hasPendingMerges = false;
+    }
+
+    size_t IdentityResolver::getMemoryUsage() {
+        return sizeof(IdentityResolver) + (parents.capacity() + sizes.capacity()) * sizeof(unsigned int);
+    }
+
+} // namespace Netvisix
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef IDENTITYRESOLVER_H
+#define IDENTITYRESOLVER_H
+
+#include <vector>
+#include <cstddef>
+
+
+namespace Netvisix {
+
+    // union-find over host ids, collects "same machine" evidence (arp / ndp / dhcp bindings, eui-64) until the
+    // hosts of a set are merged into the root (union by size, path halving)
+    class IdentityResolver {
+
+        public:
+            IdentityResolver();
+            virtual ~IdentityResolver();
+
+            void unite(unsigned int idA, unsigned int idB);
+            unsigned int find(unsigned int id);
+
+            bool getHasPendingMerges() { return this->hasPendingMerges; }
+
+            // (after the merges were applied, all ids are single sets again)
+            void clear();
+
+            size_t getMemoryUsage();
+
+        private:
+            void grow(unsigned int id);
+
+            std::vector<unsigned int> parents;
+            std::vector<unsigned int> sizes;
+            bool hasPendingMerges;
+    };
+
+} // namespace Netvisix
+#endif // IDENTITYRESOLVER_H
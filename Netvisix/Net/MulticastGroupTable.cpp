@@ -0,0 +1,155 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MulticastGroupTable.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace Netvisix {
+
+    MulticastGroupTable::MulticastGroupTable() {
+    }
+
+    MulticastGroupTable::~MulticastGroupTable() {
+    }
+
+    void MulticastGroupTable::join(const Tins::IPv6Address& group, unsigned int vlanID, unsigned int hostID, long long currentTime) {
+        AddrKey key(group, vlanID);
+        auto it = groups.find(key);
+        if (it == groups.end()) {
+            if (groups.size() >= GROUPS_MAX) {
+                return;
+            }
+            it = groups.emplace(key, std::vector<Member>()).first;
+        }
+
+        std::vector<Member>& members = it->second;
+        auto member = std::lower_bound(members.begin(), members.end(), hostID, [](const Member& m, unsigned int id) { return m.hostID < id; });
+        if (member != members.end() && member->hostID == hostID) {
+            member->lastReportTime = currentTime;
+        }
+        else {
+            Member nMember;
+            nMember.hostID = hostID;
+            nMember.lastReportTime = currentTime;
+            members.insert(member, nMember);
+        }
+    }
+
+    void MulticastGroupTable::leave(const Tins::IPv6Address& group, unsigned int vlanID, unsigned int hostID) {
+        auto it = groups.find(AddrKey(group, vlanID));
+        if (it == groups.end()) {
+            return;
+        }
+
+        std::vector<Member>& members = it->second;
+        auto member = std::lower_bound(members.begin(), members.end(), hostID, [](const Member& m, unsigned int id) { return m.hostID < id; });
+        if (member != members.end() && member->hostID == hostID) {
+            members.erase(member);
+        }
+        if (members.empty()) {
+            groups.erase(it);
+        }
+    }
+
+    const std::vector<MulticastGroupTable::Member>* MulticastGroupTable::getMembers(const Tins::IPv6Address& group, unsigned int vlanID) const {
+        auto it = groups.find(AddrKey(group, vlanID));
+        return (it != groups.end()) ? &it->second : nullptr;
+    }
+
+    void MulticastGroupTable::expire(long long currentTime) {
+        for (auto it = groups.begin(); it != groups.end();) {
+            std::vector<Member>& members = it->second;
+            members.erase(std::remove_if(members.begin(), members.end(), [currentTime](const Member& m) {
+                return currentTime - m.lastReportTime >= MEMBERSHIP_TIMEOUT;
+            }), members.end());
+
+            if (members.empty()) {
+                it = groups.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    void MulticastGroupTable::removeHosts(const std::unordered_set<unsigned int>& hostIDs) {
+        for (auto it = groups.begin(); it != groups.end();) {
+            std::vector<Member>& members = it->second;
+            members.erase(std::remove_if(members.begin(), members.end(), [&hostIDs](const Member& m) {
+                return hostIDs.count(m.hostID) > 0;
+            }), members.end());
+
+            if (members.empty()) {
+                it = groups.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    void MulticastGroupTable::mergeHosts(unsigned int rootID, const std::unordered_set<unsigned int>& mergedIDs) {
+        for (auto& group : groups) {
+            std::vector<Member>& members = group.second;
+
+            long long lastReportTime = -1;
+            auto end = std::remove_if(members.begin(), members.end(), [&mergedIDs, &lastReportTime](const Member& m) {
+                if (mergedIDs.count(m.hostID) == 0) {
+                    return false;
+                }
+                lastReportTime = std::max(lastReportTime, m.lastReportTime);
+                return true;
+            });
+            if (end == members.end()) {
+                continue;
+            }
+            members.erase(end, members.end());
+
+            auto member = std::lower_bound(members.begin(), members.end(), rootID, [](const Member& m, unsigned int id) { return m.hostID < id; });
+            if (member != members.end() && member->hostID == rootID) {
+                member->lastReportTime = std::max(member->lastReportTime, lastReportTime);
+            }
+            else {
+                Member nMember;
+                nMember.hostID = rootID;
+                nMember.lastReportTime = lastReportTime;
+                members.insert(member, nMember);
+            }
+        }
+    }
+
+    size_t MulticastGroupTable::getMemoryUsage() const {
+        size_t memoryUsage = sizeof(MulticastGroupTable) + groups.bucket_count() * sizeof(void*);
+        for (const auto& group : groups) {
+            memoryUsage += sizeof(group) + sizeof(void*) * 2 + group.second.capacity() * sizeof(Member);
+        }
+        return memoryUsage;
+    }
+
+    Tins::IPv6Address MulticastGroupTable::getGroup(const Tins::IPv4Address& ipv4Addr) {
+        uint8_t group[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 0, 0, 0, 0 };
+        uint32_t addrRaw = ipv4Addr;
+        std::memcpy(group + 12, &addrRaw, 4);
+        return Tins::IPv6Address(group);
+    }
+
+} // namespace Netvisix
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MULTICASTGROUPTABLE_H
+#define MULTICASTGROUPTABLE_H
+
+#include "Net/AddrKey.h"
+
+#include <tins.h>
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // multicast group -> member hosts per vlan, learned from igmp / mld reports (groups as in GroupReport),
+    // members are host ids in a sorted vector and time out MEMBERSHIP_TIMEOUT after their last report
+    class MulticastGroupTable {
+
+        public:
+            struct Member {
+                unsigned int hostID;
+                long long lastReportTime;
+            };
+
+            MulticastGroupTable();
+            virtual ~MulticastGroupTable();
+
+            // (currentTime in ms, monotonic)
+            void join(const Tins::IPv6Address& group, unsigned int vlanID, unsigned int hostID, long long currentTime);
+            void leave(const Tins::IPv6Address& group, unsigned int vlanID, unsigned int hostID);
+
+            // members of the group or nullptr (valid until the next change of the table)
+            const std::vector<Member>* getMembers(const Tins::IPv6Address& group, unsigned int vlanID) const;
+
+            void expire(long long currentTime);
+            void removeHosts(const std::unordered_set<unsigned int>& hostIDs);
+            // memberships of the merged hosts go to the root host (latest report time wins)
+            void mergeHosts(unsigned int rootID, const std::unordered_set<unsigned int>& mergedIDs);
+
+            void clear() { this->groups.clear(); }
+
+            size_t getGroupCount() const { return this->groups.size(); }
+            size_t getMemoryUsage() const;
+
+            // ipv4 group as stored in the table (::ffff:a.b.c.d)
+            static Tins::IPv6Address getGroup(const Tins::IPv4Address& ipv4Addr);
+
+        private:
+            std::unordered_map<AddrKey, std::vector<Member>, AddrKeyHash> groups;
+
+            // (robustness 2 * query interval 125 s + response 10 s, rfc 3376 / 3810 defaults)
+            static const long long MEMBERSHIP_TIMEOUT = 260 * 1000;
+            static const size_t GROUPS_MAX = 65536;
+    };
+
+} // namespace Netvisix
+#endif // MULTICASTGROUPTABLE_H
@@ -25,10 +25,12 @@ namespace Netvisix {
 
     NetEvent::NetEvent() {
         size = 0;
+        vlanID = 0;
 
         l1Protocol = Protocol::Unkown;
         l2Protocol = Protocol::Unkown;
         l3Protocol = Protocol::Unkown;
+        service = Service::None;
 
         srcAddrHW = NetUtil::zeroAddrHW;
         dstAddrHW = NetUtil::zeroAddrHW;
@@ -38,6 +40,23 @@ namespace Netvisix {
 
         srcAddrIPv6 = NetUtil::zeroAddrIPv6;
         dstAddrIPv6 = NetUtil::zeroAddrIPv6;
+
+        bindingAddrHW = NetUtil::zeroAddrHW;
+        bindingAddrIPv4 = NetUtil::zeroAddrIPv4;
+        bindingAddrIPv6 = NetUtil::zeroAddrIPv6;
+
+        srcPort = 0;
+        dstPort = 0;
+        isTCPSYN = false;
+        openPortTCP = 0;
+        openPortUDP = 0;
+
+        tunnel = Tunnel::None;
+        tunnelID = 0;
+        tunnelSrcAddrIPv4 = NetUtil::zeroAddrIPv4;
+        tunnelDstAddrIPv4 = NetUtil::zeroAddrIPv4;
+        tunnelSrcAddrIPv6 = NetUtil::zeroAddrIPv6;
+        tunnelDstAddrIPv6 = NetUtil::zeroAddrIPv6;
     }
 
     NetEvent::~NetEvent() {
@@ -82,6 +101,12 @@ namespace Netvisix {
 
         case Protocol::EthernetII:
             return "EthernetII";
+        case Protocol::LinuxSLL:
+            return "LinuxSLL";
+        case Protocol::Loopback:
+            return "Loopback";
+        case Protocol::RawIP:
+            return "RawIP";
 
         case Protocol::ARP:
             return "ARP";
@@ -104,6 +129,26 @@ namespace Netvisix {
         }
     }
 
+    std::string NetEvent::getTunnelString(Tunnel tunnel, uint32_t tunnelID) {
+        switch (tunnel) {
+        case Tunnel::VXLAN:
+            return "VXLAN " + std::to_string(tunnelID);
+        case Tunnel::GENEVE:
+            return "GENEVE " + std::to_string(tunnelID);
+        case Tunnel::GRE:
+            return (tunnelID != 0) ? "GRE key " + std::to_string(tunnelID) : "GRE";
+        case Tunnel::ERSPAN:
+            return "ERSPAN session " + std::to_string(tunnelID);
+        case Tunnel::MPLS:
+            return "MPLS label " + std::to_string(tunnelID);
+        case Tunnel::IPinIP:
+            return "IP-in-IP";
+
+        default:
+            return "";
+        }
+    }
+
     bool NetEvent::isIPv4() {
         return (l2Protocol == Protocol::IPv4);
     }
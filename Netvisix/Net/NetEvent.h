@@ -22,6 +22,8 @@
 
 #include <tins.h>
 
+#include <vector>
+
 
 namespace Netvisix {
 
@@ -36,6 +38,9 @@ namespace Netvisix {
 
         // layer 1
         EthernetII,
+        LinuxSLL,
+        Loopback,
+        RawIP,
 
         // layer 2
         ARP,
@@ -51,6 +56,38 @@ namespace Netvisix {
         OtherL3,
     };
 
+    // application service by well-known port (see ServiceTable)
+    enum class Service {
+        None,
+        HTTP,
+        TLS,
+        QUIC,
+        SSH,
+        Telnet,
+        FTP,
+        Mail,
+        DNS,
+        DHCP,
+        NTP,
+        SMB,
+        LDAP,
+        RDP,
+        Database,
+        SNMP,
+        VPN,
+        VoIP,
+    };
+
+    enum class Tunnel {
+        None,
+        VXLAN,
+        GENEVE,
+        GRE,
+        ERSPAN,
+        MPLS,
+        IPinIP,
+    };
+
     enum class AddrType {
         UNICAST,
         MULTICAST,
@@ -58,6 +95,12 @@ namespace Netvisix {
     };
 
 
+    // igmp / mld membership change reported by the source host (ipv4 groups as ::ffff:a.b.c.d)
+    struct GroupReport {
+        Tins::IPv6Address group;
+        bool isJoin;
+    };
+
     class NetEvent {
 
         public:
@@ -65,6 +108,7 @@ namespace Netvisix {
             virtual ~NetEvent();
 
             static std::string getProtocolString(Protocol protocol);
+            static std::string getTunnelString(Tunnel tunnel, uint32_t tunnelID);
 
             Protocol getProtocol(Layer layer);
             void setProtocol(Layer layer, Protocol protocol);
@@ -76,9 +120,16 @@ namespace Netvisix {
 
             unsigned long size;
 
+            // 802.1Q vlan id, (outer << 12) | inner for QinQ frames (0 = untagged)
+            unsigned int vlanID;
+
             Protocol l1Protocol;
             Protocol l2Protocol;
             Protocol l3Protocol;
+            Service service;
+
+            // tls sni / http host sent by the source, names the destination ("" if none)
+            std::string serverName;
 
             Tins::HWAddress<6> srcAddrHW;
             Tins::HWAddress<6> dstAddrHW;
@@ -88,6 +139,34 @@ namespace Netvisix {
 
             Tins::IPv6Address srcAddrIPv6;
             Tins::IPv6Address dstAddrIPv6;
+
+            // ip -> mac binding announced by the frame (arp sender, ndp link-layer address option, dhcp client), zero if none
+            Tins::HWAddress<6> bindingAddrHW;
+            Tins::IPv4Address bindingAddrIPv4;
+            Tins::IPv6Address bindingAddrIPv6;
+
+            // transport ports (tcp / udp, else 0), isTCPSYN for a syn without ack (connection attempt)
+            uint16_t srcPort;
+            uint16_t dstPort;
+            bool isTCPSYN;
+
+            // port the source answers on (tcp syn/ack, udp from a server port to an ephemeral one), 0 if none
+            uint16_t openPortTCP;
+            uint16_t openPortUDP;
+
+            // (empty unless the frame is an igmp / mld report)
+            std::vector<GroupReport> groupReports;
+
+            // tunnel the frame was decapsulated from, the addresses above are the inner ones then
+            // (tunnelID: vni, gre key, erspan session or outermost mpls label)
+            Tunnel tunnel;
+            uint32_t tunnelID;
+
+            // outer endpoints (zero for mpls)
+            Tins::IPv4Address tunnelSrcAddrIPv4;
+            Tins::IPv4Address tunnelDstAddrIPv4;
+            Tins::IPv6Address tunnelSrcAddrIPv6;
+            Tins::IPv6Address tunnelDstAddrIPv6;
     };
 
 } // namespace Netvisix
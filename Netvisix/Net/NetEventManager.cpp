@@ -24,6 +24,20 @@
 #include "Net/PacketHandler.h"
 #include "Net/NetUtil.h"
 #include "Net/NetStatistic.h"
+#include "Net/HostChangeTracker.h"
+#include "Net/IHostRemovalListener.h"
+#include "Net/PrefixTable.h"
+#include "Net/DNSCache.h"
+#include "Net/BindingTable.h"
+#include "Net/IdentityResolver.h"
+#include "Net/MulticastGroupTable.h"
+#include "Net/AnomalyDetector.h"
+#include "Net/ReverseDNSService.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <unordered_set>
 
 
 namespace Netvisix {
@@ -40,17 +54,57 @@ namespace Netvisix {
 
     NetEventManager::NetEventManager() {
         hosts = new std::vector<Host*>();
+        nextHostID = 0;
         packetHandler = nullptr;
         netEventCounter = 0;
         hostLocalInterface = nullptr;
-        dnsAnswers = new std::vector<DNSAnswer*>();
+        dnsCache = new DNSCache();
+        bindingTable = new BindingTable();
+        identityResolver = new IdentityResolver();
+        multicastGroupTable = new MulticastGroupTable();
+        anomalyDetector = new AnomalyDetector();
+        reverseDNSService = new ReverseDNSService(onReverseDNSAnswer);
+        reverseDNSLookupEnabled = false;
         setIsPaused(false);
+
+        currentTime = getCurrentTime();
+        memoryBudget = MEMORY_BUDGET_DEFAULT;
+        memoryUsage = 0;
+        otherStatisticSubnet = new NetStatistic();
+        otherStatisticOutsideSubnet = new NetStatistic();
+        evictedHostCount = 0;
+
+        localSubnetTableIPv4 = new PrefixTable(4);
+        localSubnetTableIPv6 = new PrefixTable(16);
+        vlanSubnetTableIPv4 = new PrefixTable(3 + 4);
+        vlanSubnetTableIPv6 = new PrefixTable(3 + 16);
+        currentVlanID = 0;
+        setLocalSubnets("", "fd00::/8");
+
+        setAggregationPrefixes(0, 0);
     }
 
     NetEventManager::~NetEventManager() {
+        // (workers may still hand in answers)
+        delete reverseDNSService;
+        reverseDNSService = nullptr;
+
         reset();
         delete hosts;
-        delete dnsAnswers;
+        for (auto hostChangeTracker : hostChangeTrackers) {
+            delete hostChangeTracker;
+        }
+        delete dnsCache;
+        delete bindingTable;
+        delete identityResolver;
+        delete multicastGroupTable;
+        delete anomalyDetector;
+        delete otherStatisticSubnet;
+        delete otherStatisticOutsideSubnet;
+        delete localSubnetTableIPv4;
+        delete localSubnetTableIPv6;
+        delete vlanSubnetTableIPv4;
+        delete vlanSubnetTableIPv6;
         if (hostLocalInterface != nullptr) {
             delete hostLocalInterface;
         }
@@ -63,13 +117,14 @@ namespace Netvisix {
         }
     }
 
-    void NetEventManager::startSniffing(std::string interfaceName, bool promiscMode, std::string subnetIPv4, std::string subnetIPv6) {
+    void NetEventManager::startSniffing(std::string interfaceName, bool promiscMode, std::string subnetsIPv4, std::string subnetsIPv6) {
         stopSniffing();
 
         initHostLocalInterface(interfaceName);
 
-        this->subnetIPv4 = NetUtil::getSubnetRangeIPv4(subnetIPv4);
-        this->subnetIPv6UniqueLocal = NetUtil::getSubnetRangeIPv6(subnetIPv6);
+        mutex.lock();
+        setLocalSubnets(subnetsIPv4, subnetsIPv6);
+        mutex.unlock();
 
         packetHandler = new PacketHandler(interfaceName, promiscMode);
         packetHandler->start();
@@ -94,11 +149,45 @@ namespace Netvisix {
             delete hosts->at(i);
         }
         hosts->clear();
+        hostsByID.clear();
+        nextHostID = 0;
+        freeHostIDs.clear();
+        lruList.clear();
+        memoryUsage = 0;
+        aggregateHosts.clear();
+        expandedPrefixes.clear();
+        hostsByHW.clear();
+        hostsByAddr.clear();
+
+        for (auto& vlanStatistic : vlanStatistics) {
+            delete vlanStatistic.second;
+        }
+        vlanStatistics.clear();
+        currentVlanID = 0;
+
+        for (auto& tunnelStatistic : tunnelStatistics) {
+            delete tunnelStatistic.second;
+        }
+        tunnelStatistics.clear();
+
+        delete otherStatisticSubnet;
+        delete otherStatisticOutsideSubnet;
+        otherStatisticSubnet = new NetStatistic();
+        otherStatisticOutsideSubnet = new NetStatistic();
+        evictedHostCount = 0;
 
-        for (unsigned int i = 0; i < dnsAnswers->size(); i++) {
-            delete dnsAnswers->at(i);
+        for (auto hostChangeTracker : hostChangeTrackers) {
+            hostChangeTracker->reset();
+        }
+
+        dnsCache->clear();
+        bindingTable->clear();
+        identityResolver->clear();
+        multicastGroupTable->clear();
+        anomalyDetector->clear();
+        if (reverseDNSService != nullptr) {
+            reverseDNSService->clear();
         }
-        dnsAnswers->clear();
 
         netEventCounter = 0;
         setIsPaused(false);
@@ -140,85 +229,511 @@ namespace Netvisix {
         }
     }
 
+    HostChangeTracker* NetEventManager::createHostChangeTracker() {
+        HostChangeTracker* hostChangeTracker = new HostChangeTracker();
+        hostChangeTrackers.push_back(hostChangeTracker);
+        return hostChangeTracker;
+    }
+
+    void NetEventManager::addHostRemovalListener(IHostRemovalListener* listener) {
+        mutex.lock();
+        hostRemovalListeners.push_back(listener);
+        mutex.unlock();
+    }
+
+    void NetEventManager::removeHostRemovalListener(IHostRemovalListener* listener) {
+        mutex.lock();
+        hostRemovalListeners.erase(std::remove(hostRemovalListeners.begin(), hostRemovalListeners.end(), listener), hostRemovalListeners.end());
+        mutex.unlock();
+    }
+
+    NetStatistic* NetEventManager::getOtherStatistic(NetArea netArea) {
+        return (netArea == NetArea::SUBNET) ? otherStatisticSubnet : otherStatisticOutsideSubnet;
+    }
+
+    void NetEventManager::getOtherCounters(NetArea netArea, unsigned long long& frames, unsigned long long& bytes) {
+        mutex.lock();
+        NetStatistic::Item* item = getOtherStatistic(netArea)->getItem(IPVersion::ALL, Protocol::EthernetII);
+        frames = item->framesSnt + item->framesRcv;
+        bytes = item->bytesSnt + item->bytesRcv;
+        mutex.unlock();
+    }
+
+    long long NetEventManager::getCurrentTime() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void NetEventManager::touchHost(Host* host) {
+        host->setLastSeenTime(currentTime);
+        lruList.splice(lruList.begin(), lruList, host->getLRUIterator());
+    }
+
+    void NetEventManager::evictHosts(size_t consumerMemoryUsage) {
+        long long now = getCurrentTime();
+
+        mutex.lock();
+
+        applyHostMerges();
+
+        memoryUsage = 0;
+        for (Host* host : *hosts) {
+            memoryUsage += host->getMemoryUsage();
+            if (host->getAnomalies() != 0 && now - host->getAnomalyTime() >= ANOMALY_HOLD_TIME) {
+                host->clearAnomalies();
+            }
+        }
+
+        dnsCache->expire(now);
+        memoryUsage += dnsCache->getMemoryUsage();
+        bindingTable->expire(now);
+        memoryUsage += bindingTable->getMemoryUsage();
+        memoryUsage += identityResolver->getMemoryUsage();
+        multicastGroupTable->expire(now);
+        memoryUsage += multicastGroupTable->getMemoryUsage() + hostsByID.capacity() * sizeof(Host*);
+        memoryUsage += anomalyDetector->getMemoryUsage();
+        memoryUsage += hostsByAddr.bucket_count() * sizeof(void*) + hostsByAddr.size() * (sizeof(AddrKey) + sizeof(Host*) + sizeof(void*) * 2);
+        memoryUsage += reverseDNSService->getMemoryUsage();
+
+        std::vector<Host*> hostsToRemove;
+        std::unordered_set<Host*> selectedHosts;
+
+        // idle hosts outside the subnet (the lru tail is the oldest)
+        for (auto it = lruList.rbegin(); it != lruList.rend(); ++it) {
+            Host* host = *it;
+            if (now - host->getLastSeenTime() < HOST_IDLE_TIMEOUT) {
+                break;
+            }
+            if (host->getNetArea() == NetArea::OUTSIDE_SUBNET || host->getNetArea() == NetArea::UNKOWN) {
+                hostsToRemove.push_back(host);
+                selectedHosts.insert(host);
+            }
+        }
+
+        // memory budget (least recently seen first, outside the subnet before subnet hosts)
+        size_t totalMemoryUsage = memoryUsage + consumerMemoryUsage;
+        if (totalMemoryUsage > memoryBudget && ! hosts->empty()) {
+            size_t memoryPerHost = std::max(totalMemoryUsage / hosts->size(), (size_t) 1);
+            size_t excess = totalMemoryUsage - (size_t) (memoryBudget * EVICTION_TARGET);
+            size_t evictCount = excess / memoryPerHost + 1;
+
+            for (int pass = 0; pass < 2 && hostsToRemove.size() < evictCount; pass++) {
+                for (auto it = lruList.rbegin(); it != lruList.rend() && hostsToRemove.size() < evictCount; ++it) {
+                    Host* host = *it;
+                    bool isSubnetHost = (host->getNetArea() == NetArea::SUBNET);
+                    if (host->getNetArea() == NetArea::LOCAL_INTERFACE || isSubnetHost != (pass == 1)) {
+                        continue;
+                    }
+                    if (selectedHosts.insert(host).second) {
+                        hostsToRemove.push_back(host);
+                    }
+                }
+            }
+        }
+
+        removeHosts(hostsToRemove, true);
+
+        mutex.unlock();
+    }
+
+    void NetEventManager::removeHosts(const std::vector<Host*>& hostsToRemove, bool isEviction) {
+        if (hostsToRemove.empty()) {
+            return;
+        }
+
+        // (consumers drop their references first)
+        for (auto listener : hostRemovalListeners) {
+            listener->onHostsRemoved(hostsToRemove);
+        }
+
+        std::unordered_set<Host*> removed(hostsToRemove.begin(), hostsToRemove.end());
+        hosts->erase(std::remove_if(hosts->begin(), hosts->end(), [&removed](Host* h) { return removed.count(h) > 0; }), hosts->end());
+
+        std::unordered_set<unsigned int> removedIDs;
+        for (Host* host : hostsToRemove) {
+            removedIDs.insert(host->getID());
+            hostsByID[host->getID()] = nullptr;
+        }
+        // (merged hosts handed their memberships to the root before)
+        if (isEviction) {
+            multicastGroupTable->removeHosts(removedIDs);
+        }
+
+        for (Host* host : hostsToRemove) {
+            if (host->getIsAggregate()) {
+                aggregateHosts.erase(getAggregateKey(host));
+            }
+
+            auto itHW = hostsByHW.find(getHWKey(host->getAddrHW(), host->getVlanID()));
+            if (itHW != hostsByHW.end() && itHW->second == host) {
+                hostsByHW.erase(itHW);
+            }
+            unindexHostAddrs(host);
+
+            for (auto hostChangeTracker : hostChangeTrackers) {
+                hostChangeTracker->removeHost(host);
+            }
+
+            lruList.erase(host->getLRUIterator());
+
+            // roll up into the "other" bucket
+            if (isEviction) {
+                getOtherStatistic(host->getNetArea())->add(host->statistic);
+                evictedHostCount++;
+            }
+
+            memoryUsage -= std::min(memoryUsage, host->getMemoryUsage());
+
+            freeHostIDs.push_back(host->getID());
+            delete host;
+        }
+    }
+
+    void NetEventManager::setAggregationPrefixes(unsigned int prefixIPv4, unsigned int prefixIPv6) {
+        mutex.lock();
+        aggregationPrefixIPv4 = std::min(prefixIPv4, 32u);
+        aggregationPrefixIPv6 = std::min(prefixIPv6, 128u);
+        aggregationMaskIPv4 = Tins::IPv4Address::from_prefix_length(aggregationPrefixIPv4);
+        aggregationMaskIPv6 = Tins::IPv6Address::from_prefix_length(aggregationPrefixIPv6);
+        mutex.unlock();
+    }
+
+    NetEventManager::AggregateKey NetEventManager::getAggregateKey(Tins::IPv4Address prefix, unsigned int prefixLength, unsigned int vlanID) {
+        return AggregateKey(vlanID, (uint64_t(1) << 63) | ((uint64_t) prefixLength << 32) | (uint32_t) prefix);
+    }
+
+    NetEventManager::AggregateKey NetEventManager::getAggregateKey(Tins::IPv6Address prefix, unsigned int prefixLength, unsigned int vlanID) {
+        // (the first 48 bits, longer prefixes share a key and get merged)
+        uint64_t key = (uint64_t(1) << 62) | ((uint64_t) (prefixLength & 0x3f) << 48);
+        Tins::IPv6Address::const_iterator it = prefix.begin();
+        for (int i = 0; i < 6; i++) {
+            key |= (uint64_t) it[i] << (40 - i * 8);
+        }
+        return AggregateKey(vlanID, key);
+    }
+
+    NetEventManager::AggregateKey NetEventManager::getAggregateKey(Host* aggregateHost) {
+        if (! aggregateHost->getAddrListIPv4().empty()) {
+            return getAggregateKey(aggregateHost->getAddrListIPv4().at(0), aggregateHost->getAggregatePrefixLength(), aggregateHost->getVlanID());
+        }
+        return getAggregateKey(aggregateHost->getAddrListIPv6().at(0), aggregateHost->getAggregatePrefixLength(), aggregateHost->getVlanID());
+    }
+
+    Host* NetEventManager::getAggregateHost(Tins::IPv4Address ipv4Addr) {
+        if (aggregationPrefixIPv4 == 0 || aggregateHosts.empty() || getIsHostInSubnet(ipv4Addr)) {
+            return nullptr;
+        }
+
+        auto it = aggregateHosts.find(getAggregateKey(ipv4Addr & aggregationMaskIPv4, aggregationPrefixIPv4, currentVlanID));
+        return (it != aggregateHosts.end()) ? it->second : nullptr;
+    }
+
+    Host* NetEventManager::getAggregateHost(Tins::IPv6Address ipv6Addr) {
+        if (aggregationPrefixIPv6 == 0 || aggregateHosts.empty() || getIsHostInSubnet(ipv6Addr)) {
+            return nullptr;
+        }
+
+        auto it = aggregateHosts.find(getAggregateKey(ipv6Addr & aggregationMaskIPv6, aggregationPrefixIPv6, currentVlanID));
+        return (it != aggregateHosts.end()) ? it->second : nullptr;
+    }
+
+    Host* NetEventManager::addAggregateHost(Tins::IPv4Address ipv4Addr) {
+        Tins::IPv4Address prefix = ipv4Addr & aggregationMaskIPv4;
+        AggregateKey key = getAggregateKey(prefix, aggregationPrefixIPv4, currentVlanID);
+        if (expandedPrefixes.count(key) > 0) {
+            return nullptr;
+        }
+
+        Host* nHost = new Host();
+        nHost->addAddrIPv4(prefix, false);
+        nHost->setAggregatePrefixLength(aggregationPrefixIPv4);
+        nHost->setNetArea(NetArea::OUTSIDE_SUBNET);
+        nHost->addAggregateMember(ipv4Addr);
+        aggregateHosts[key] = nHost;
+        addHost(nHost);
+
+        return nHost;
+    }
+
+    Host* NetEventManager::addAggregateHost(Tins::IPv6Address ipv6Addr) {
+        Tins::IPv6Address prefix = ipv6Addr & aggregationMaskIPv6;
+        AggregateKey key = getAggregateKey(prefix, aggregationPrefixIPv6, currentVlanID);
+        if (expandedPrefixes.count(key) > 0) {
+            return nullptr;
+        }
+
+        Host* nHost = new Host();
+        nHost->addAddrIPv6(prefix, false);
+        nHost->setAggregatePrefixLength(aggregationPrefixIPv6);
+        nHost->setNetArea(NetArea::OUTSIDE_SUBNET);
+        nHost->addAggregateMember(ipv6Addr);
+        aggregateHosts[key] = nHost;
+        addHost(nHost);
+
+        return nHost;
+    }
+
+    void NetEventManager::expandAggregateHost(Host* host) {
+        if (host == nullptr || ! host->getIsAggregate()) {
+            return;
+        }
+
+        mutex.lock();
+
+        // (later packets of this prefix create single hosts)
+        expandedPrefixes.insert(getAggregateKey(host));
+
+        std::set<Tins::IPv4Address> membersIPv4 = host->getAggregateMembersIPv4();
+        std::set<Tins::IPv6Address> membersIPv6 = host->getAggregateMembersIPv6();
+
+        // (member hosts stay in the vlan of the aggregate)
+        currentVlanID = host->getVlanID();
+        currentTime = getCurrentTime();
+
+        std::vector<Host*> memberHosts;
+        for (const Tins::IPv4Address& member : membersIPv4) {
+            Host* nHost = new Host();
+            nHost->addAddrIPv4(member, false);
+            memberHosts.push_back(nHost);
+        }
+        for (const Tins::IPv6Address& member : membersIPv6) {
+            Host* nHost = new Host();
+            nHost->addAddrIPv6(member, false);
+            memberHosts.push_back(nHost);
+        }
+
+        // a drill-down, not an eviction: the per member traffic is unknown, the counters of the
+        // aggregate are split evenly so the totals stay the same
+        for (unsigned int i = 0; i < memberHosts.size(); i++) {
+            memberHosts[i]->statistic->add(host->statistic, i, memberHosts.size());
+        }
+        // (the id is reused, group reports are link local and an aggregate should have none anyway)
+        multicastGroupTable->removeHosts(std::unordered_set<unsigned int>({ host->getID() }));
+        removeHosts(std::vector<Host*>(1, host), memberHosts.empty());
+
+        for (Host* nHost : memberHosts) {
+            nHost->setNetArea(NetArea::OUTSIDE_SUBNET);
+            addHost(nHost);
+        }
+
+        mutex.unlock();
+    }
+
+    void NetEventManager::setHostDirty(Host* host) {
+        for (auto hostChangeTracker : hostChangeTrackers) {
+            hostChangeTracker->setHostDirty(host);
+        }
+    }
+
     void NetEventManager::onHostAddrUpdate(Host* host) {
+        if (host->getAddrHW() != NetUtil::zeroAddrHW) {
+            hostsByHW.emplace(getHWKey(host->getAddrHW(), host->getVlanID()), host);
+        }
+        indexHostAddrs(host);
+
+        setHostDirty(host);
+
         for (auto listener : pneListeners) {
             listener->onHostAddrUpdate(host);
         }
     }
 
-    void NetEventManager::handleDNSAnswer(std::string ipAddr, std::string hostname) {
-        if (ipAddr.empty() || hostname.empty()) {
+    void NetEventManager::handleDNSAnswer(const uint8_t* addr, unsigned int addrLength, const char* hostname, uint32_t ttl, unsigned int vlanID) {
+        // (a / aaaa records only)
+        if ((addrLength != 4 && addrLength != 16) || hostname[0] == '\0') {
             return;
         }
 
-        removeOldDNSAnswers();
+        mutex.lock();
+        currentTime = getCurrentTime();
+        currentVlanID = vlanID;
 
-        for (unsigned int i = 0; i < dnsAnswers->size(); i++) {
-            DNSAnswer* dnsAnswer = dnsAnswers->at(i);
-            if (dnsAnswer->ipAddr == ipAddr) {
-                return;
-            }
+        std::string name = hostname;
+        dnsCache->add(AddrKey(addr, addrLength, vlanID), name, ttl, currentTime);
+
+        // answer after the host appeared
+        Host* host = nullptr;
+        if (addrLength == 4) {
+            uint32_t addrRaw;
+            std::memcpy(&addrRaw, addr, 4);
+            host = getHost(Tins::IPv4Address(addrRaw));
+        }
+        else {
+            host = getHost(Tins::IPv6Address(addr));
+        }
+        if (host != nullptr && host->getIsAggregate() == false
+                && (host->getHostname().empty() || host->getHostnameIsFromReverseDNSLookp())) {
+
+            host->setHostnameIsFromReverseDNSLookp(false);
+            host->setHostname(name, true);
         }
 
-        // create new entry
-        DNSAnswer* dnsAnswer = new DNSAnswer();
-        dnsAnswer->ipAddr = ipAddr;
-        dnsAnswer->hostname = hostname;
-        dnsAnswer->timeStamp = std::clock();
-        dnsAnswers->push_back(dnsAnswer);
+        mutex.unlock();
     }
 
-    void NetEventManager::removeOldDNSAnswers() {
-        const float maxAge = 5.0f;
-        std::clock_t currentTime = std::clock();
+    void NetEventManager::handleNameRelease(const uint8_t* addr, unsigned int addrLength, const char* hostname, unsigned int vlanID) {
+        if ((addrLength != 4 && addrLength != 16) || hostname[0] == '\0') {
+            return;
+        }
+
+        mutex.lock();
+        currentTime = getCurrentTime();
+        currentVlanID = vlanID;
+
+        std::string name = hostname;
+        dnsCache->remove(AddrKey(addr, addrLength, vlanID), name);
+
+        Host* host = nullptr;
+        if (addrLength == 4) {
+            uint32_t addrRaw;
+            std::memcpy(&addrRaw, addr, 4);
+            host = getHost(Tins::IPv4Address(addrRaw));
+        }
+        else {
+            host = getHost(Tins::IPv6Address(addr));
+        }
+        if (host != nullptr && host->getIsAggregate() == false && host->getHostname() == name) {
+            // (another cached answer for the host's addresses or nothing)
+            host->setHostname("", false);
+            setHostnameFromDNSAnswers(host);
+            host->setHostname(host->getHostname(), true);
+        }
 
-        for (auto it = dnsAnswers->begin(); it != dnsAnswers->end();) {
-            DNSAnswer* dnsAnswer = (*it);
-            float age = (float) (currentTime - dnsAnswer->timeStamp) / CLOCKS_PER_SEC;
+        mutex.unlock();
+    }
 
-            if (age >= maxAge) {
-                delete *it;
-                it = dnsAnswers->erase(it);
+    void NetEventManager::setHostnameFromDNSAnswers(Host* host) {
+        for (const Tins::IPv4Address& ipv4Addr : host->getAddrListIPv4()) {
+            std::string hostname = dnsCache->get(AddrKey(ipv4Addr, host->getVlanID()));
+            if (hostname.empty() == false) {
+                host->setHostname(hostname, false);
+                return;
             }
-            else {
-                ++it;
+        }
+
+        for (const Tins::IPv6Address& ipv6Addr : host->getAddrListIPv6()) {
+            std::string hostname = dnsCache->get(AddrKey(ipv6Addr, host->getVlanID()));
+            if (hostname.empty() == false) {
+                host->setHostname(hostname, false);
+                return;
             }
         }
     }
 
-    void NetEventManager::setHostnameFromDNSAnswers(Host* host) {
-        if (host->getAddrListIPv4().empty() && host->getAddrListIPv6().empty()) {
+    void NetEventManager::setReverseDNSLookupEnabled(bool enabled) {
+        mutex.lock();
+        reverseDNSLookupEnabled = enabled;
+        for (Host* host : *hosts) {
+            requestReverseDNSLookup(host);
+        }
+        mutex.unlock();
+    }
+
+    void NetEventManager::requestReverseDNSLookup(Host* host) {
+        if (reverseDNSLookupEnabled == false || host->getHostname().empty() == false || host->getIsAggregate()) {
             return;
         }
 
-        removeOldDNSAnswers();
+        std::string ipAddr;
+        if (host->getAddrListIPv4().empty() == false) {
+            ipAddr = host->getAddrListIPv4().front().to_string();
+        }
+        else if (host->getAddrListIPv6().empty() == false) {
+            ipAddr = host->getAddrListIPv6().front().to_string();
+        }
+        else {
+            return;
+        }
 
-        for (unsigned int i = 0; i < dnsAnswers->size(); i++) {
-            DNSAnswer* dnsAnswer = dnsAnswers->at(i);
+        // (cached names right away, the others come in via onReverseDNSAnswer)
+        std::string hostname = reverseDNSService->request(ipAddr);
+        if (hostname.empty() == false) {
+            host->setHostname(hostname, false);
+            host->setHostnameIsFromReverseDNSLookp(true);
+        }
+    }
 
-            if (host->getAddrIPv4(dnsAnswer->ipAddr) != NetUtil::zeroAddrIPv4
-                    || host->getAddrIPv6(dnsAnswer->ipAddr) != NetUtil::zeroAddrIPv6) {
+    void NetEventManager::onReverseDNSAnswer(const std::string& ipAddr, const std::string& hostname) {
+        SharedInstance()->handleReverseDNSAnswer(ipAddr, hostname);
+    }
 
-                host->setHostname(dnsAnswer->hostname, false);
-                break;
+    void NetEventManager::handleReverseDNSAnswer(const std::string& ipAddr, const std::string& hostname) {
+        Tins::IPv4Address ipv4Addr = NetUtil::zeroAddrIPv4;
+        Tins::IPv6Address ipv6Addr = NetUtil::zeroAddrIPv6;
+        try {
+            if (ipAddr.find(':') == std::string::npos) {
+                ipv4Addr = Tins::IPv4Address(ipAddr);
+            }
+            else {
+                ipv6Addr = Tins::IPv6Address(ipAddr);
+            }
+        }
+        catch (std::exception& e) {
+            return;
+        }
+
+        // (the resolver does not know about vlans, hosts with this address in all vlans seen)
+        mutex.lock();
+        std::vector<Host*> namedHosts;
+        for (auto& vlanStatistic : vlanStatistics) {
+            AddrKey key = (ipv4Addr != NetUtil::zeroAddrIPv4) ? AddrKey(ipv4Addr, vlanStatistic.first) : AddrKey(ipv6Addr, vlanStatistic.first);
+            auto range = hostsByAddr.equal_range(key);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second->getIsAggregate() == false && it->second->getHostname().empty()) {
+                    namedHosts.push_back(it->second);
+                }
             }
         }
+        // (setHostname updates the index)
+        for (Host* host : namedHosts) {
+            host->setHostnameIsFromReverseDNSLookp(true);
+            host->setHostname(hostname, true);
+        }
+        mutex.unlock();
     }
 
     void NetEventManager::handleNetEvent(NetEvent* ne) {
 //        std::cout << getDebugString(ne) << std::endl;
 
+        mutex.lock();
+        currentTime = getCurrentTime();
+        currentVlanID = ne->vlanID;
+
+        NetStatistic*& vlanStatistic = vlanStatistics[currentVlanID];
+        if (vlanStatistic == nullptr) {
+            vlanStatistic = new NetStatistic();
+        }
+        vlanStatistic->handleNetEvent(TrafficDirection::TD_OUT, ne);
+
+        if (ne->tunnel != Tunnel::None) {
+            NetStatistic*& tunnelStatistic = tunnelStatistics[std::make_pair(ne->tunnel, ne->tunnelID)];
+            if (tunnelStatistic == nullptr) {
+                tunnelStatistic = new NetStatistic();
+            }
+            tunnelStatistic->handleNetEvent(TrafficDirection::TD_OUT, ne);
+        }
+
+        if (ne->bindingAddrHW != NetUtil::zeroAddrHW) {
+            handleBinding(ne);
+        }
+
         handleNewHosts(ne);
 
+        if (ne->serverName.empty() == false) {
+            handleServerName(ne);
+        }
+
+        if (ne->groupReports.empty() == false) {
+            handleGroupReports(ne);
+        }
+
         handleNewPackets(ne);
 
         netEventCounter++;
+        mutex.unlock();
     }
 
     void NetEventManager::handleNewPackets(NetEvent* ne) {
-        if (pneListeners.size() == 0) {
-            return;
-        }
+        // (host statistics & anomaly detection run without listeners too, the dispatch loops are empty then)
 
         // broadcast or multicast
         if (getAddrType(ne->dstAddrHW) == AddrType::MULTICAST
@@ -228,11 +743,17 @@ namespace Netvisix {
             Host* sender = getHost(ne->srcAddrHW, ne->srcAddrIPv4, ne->srcAddrIPv6);
             if (sender != nullptr) {
                 sender->statistic->handleNetEvent(TrafficDirection::TD_OUT, ne);
+                setHostTunnel(sender, ne, true);
+                touchHost(sender);
+                setHostDirty(sender);
                 for (auto listener : pneListeners) {
                     listener->onPreparedNetEventNewMulticastPacket(sender, ne);
                 }
             }
 
+            handleGroupMembers(sender, ne);
+            handleAnomalies(sender, nullptr, ne);
+
             return;
         }
 
@@ -250,6 +771,13 @@ namespace Netvisix {
         }
         else {
             sender->statistic->handleNetEvent(TrafficDirection::TD_OUT, ne);
+            setHostTunnel(sender, ne, true);
+            if (ne->openPortTCP != 0 && sender->getIsAggregate() == false) {
+                sender->getOpenPorts(false).add(ne->openPortTCP);
+            }
+            if (ne->openPortUDP != 0 && sender->getIsAggregate() == false) {
+                sender->getOpenPorts(true).add(ne->openPortUDP);
+            }
         }
 
         // receiver
@@ -265,21 +793,263 @@ namespace Netvisix {
         }
         else {
             receiver->statistic->handleNetEvent(TrafficDirection::TD_IN, ne);
+            setHostTunnel(receiver, ne, false);
         }
 
+        handleAnomalies(sender, receiver, ne);
+
+        touchHost(sender);
+        touchHost(receiver);
+        setHostDirty(sender);
+        setHostDirty(receiver);
+
         for (auto listener : pneListeners) {
             listener->onPreparedNetEventNewUnicastPacket(sender, receiver, ne);
         }
     }
 
+    void NetEventManager::handleAnomalies(Host* sender, Host* receiver, NetEvent* ne) {
+        uint8_t senderAnomalies;
+        uint8_t receiverAnomalies;
+        anomalyDetector->handleNetEvent(ne, currentTime, senderAnomalies, receiverAnomalies);
+
+        if (senderAnomalies != 0 && sender != nullptr) {
+            sender->addAnomalies(senderAnomalies, currentTime);
+        }
+        if (receiverAnomalies != 0 && receiver != nullptr) {
+            receiver->addAnomalies(receiverAnomalies, currentTime);
+        }
+    }
+
+    void NetEventManager::handleServerName(NetEvent* ne) {
+        Host* host = getHost(NetUtil::zeroAddrHW, ne->dstAddrIPv4, ne->dstAddrIPv6);
+        if (host == nullptr || host->getIsAggregate() || host->getHostnameIsFromServerName()) {
+            return;
+        }
+
+        // (replaces dns names of outside hosts too, those are often cdn wide)
+        if (host->getHostname().empty() || host->getHostnameIsFromReverseDNSLookp() || host->getNetArea() == NetArea::OUTSIDE_SUBNET) {
+            host->setHostnameIsFromReverseDNSLookp(false);
+            host->setHostnameIsFromServerName(true);
+            host->setHostname(ne->serverName, true);
+        }
+    }
+
+    void NetEventManager::handleBinding(NetEvent* ne) {
+        bool isIPv4 = (ne->bindingAddrIPv4 != NetUtil::zeroAddrIPv4);
+        if (getAddrType(ne->bindingAddrHW) != AddrType::UNICAST
+                || (isIPv4 && getAddrType(ne->bindingAddrIPv4) != AddrType::UNICAST)
+                || (! isIPv4 && getAddrType(ne->bindingAddrIPv6) != AddrType::UNICAST)) {
+            return;
+        }
+
+        if (isIPv4) {
+            bindingTable->add(ne->bindingAddrIPv4, currentVlanID, ne->bindingAddrHW, currentTime);
+        }
+        else {
+            bindingTable->add(ne->bindingAddrIPv6, currentVlanID, ne->bindingAddrHW, currentTime);
+        }
+
+        Host* hHW = getHost(ne->bindingAddrHW);
+        Host* hIP = isIPv4 ? getHost(ne->bindingAddrIPv4) : getHost(ne->bindingAddrIPv6);
+        if (hHW == hIP) {
+            return;
+        }
+
+        if (hHW != nullptr && hIP != nullptr) {
+            // two known hosts of one machine
+            uniteHosts(hHW, hIP);
+        }
+        else if (hHW != nullptr && ! hHW->getIsAggregate()) {
+            // mac known / add ip (dual stack hosts get both address families)
+            if (isIPv4) {
+                hHW->addAddrIPv4(ne->bindingAddrIPv4, true);
+            }
+            else {
+                hHW->addAddrIPv6(ne->bindingAddrIPv6, true);
+            }
+        }
+        else if (hIP != nullptr && ! hIP->getIsAggregate() && hIP->getAddrHW() == NetUtil::zeroAddrHW) {
+            // ip known without mac / the address is on link (net area stays, the layout placed the host by it)
+            hIP->setAddrHW(ne->bindingAddrHW, true);
+        }
+    }
+
+    void NetEventManager::handleGroupReports(NetEvent* ne) {
+        Host* member = getHost(ne->srcAddrHW, ne->srcAddrIPv4, ne->srcAddrIPv6);
+        if (member == nullptr || member->getIsAggregate()) {
+            return;
+        }
+
+        for (const GroupReport& report : ne->groupReports) {
+            if (report.isJoin) {
+                multicastGroupTable->join(report.group, currentVlanID, member->getID(), currentTime);
+            }
+            else {
+                multicastGroupTable->leave(report.group, currentVlanID, member->getID());
+            }
+        }
+    }
+
+    void NetEventManager::handleGroupMembers(Host* sender, NetEvent* ne) {
+        const std::vector<MulticastGroupTable::Member>* members = nullptr;
+        if (ne->isIPv4() && ne->dstAddrIPv4.is_multicast()) {
+            members = multicastGroupTable->getMembers(MulticastGroupTable::getGroup(ne->dstAddrIPv4), currentVlanID);
+        }
+        else if (ne->isIPv6() && ne->dstAddrIPv6.is_multicast()) {
+            members = multicastGroupTable->getMembers(ne->dstAddrIPv6, currentVlanID);
+        }
+        if (members == nullptr) {
+            return;
+        }
+
+        for (const MulticastGroupTable::Member& member : *members) {
+            Host* receiver = (member.hostID < hostsByID.size()) ? hostsByID[member.hostID] : nullptr;
+            if (receiver != nullptr && receiver != sender) {
+                receiver->statistic->handleNetEvent(TrafficDirection::TD_IN, ne);
+                setHostDirty(receiver);
+            }
+        }
+    }
+
+    void NetEventManager::uniteHosts(Host* hostA, Host* hostB) {
+        if (hostA == hostB || hostA->getIsAggregate() || hostB->getIsAggregate()) {
+            return;
+        }
+
+        // (two macs are two machines, the ip moved)
+        if (hostA->getAddrHW() != NetUtil::zeroAddrHW && hostB->getAddrHW() != NetUtil::zeroAddrHW
+                && hostA->getAddrHW() != hostB->getAddrHW()) {
+            return;
+        }
+
+        identityResolver->unite(hostA->getID(), hostB->getID());
+    }
+
+    void NetEventManager::checkEUI64Identity(Host* host) {
+        if (host->getIsAggregate()) {
+            return;
+        }
+
+        // ipv6 host / host of the mac in the interface id
+        for (const Tins::IPv6Address& ipv6Addr : host->getAddrListIPv6()) {
+            Host* hHW = getHost(NetUtil::getEUI64AddrHW(ipv6Addr));
+            if (hHW != nullptr) {
+                uniteHosts(host, hHW);
+            }
+        }
+
+        // mac host / host of its link local address
+        if (host->getAddrHW() != NetUtil::zeroAddrHW) {
+            Host* hIP = getHost(NetUtil::getEUI64LinkLocalAddrIPv6(host->getAddrHW()));
+            if (hIP != nullptr) {
+                uniteHosts(host, hIP);
+            }
+        }
+    }
+
+    void NetEventManager::applyHostMerges() {
+        if (identityResolver->getHasPendingMerges() == false) {
+            return;
+        }
+
+        // (root host of a set -> the other hosts of the set)
+        std::unordered_map<Host*, std::vector<Host*>> merges;
+        for (Host* host : *hosts) {
+            unsigned int rootID = identityResolver->find(host->getID());
+            Host* root = (rootID < hostsByID.size()) ? hostsByID[rootID] : nullptr;
+            if (root == nullptr || root == host) {
+                continue;
+            }
+
+            // (transitive evidence may join two macs)
+            if (root->getAddrHW() != NetUtil::zeroAddrHW && host->getAddrHW() != NetUtil::zeroAddrHW
+                    && root->getAddrHW() != host->getAddrHW()) {
+                continue;
+            }
+            merges[root].push_back(host);
+        }
+        identityResolver->clear();
+
+        std::vector<Host*> mergedHosts;
+        for (auto& merge : merges) {
+            for (Host* mergedHost : merge.second) {
+                merge.first->merge(mergedHost);
+            }
+            for (auto listener : hostRemovalListeners) {
+                listener->onHostsMerged(merge.first, merge.second);
+            }
+
+            std::unordered_set<unsigned int> mergedIDs;
+            for (Host* mergedHost : merge.second) {
+                mergedIDs.insert(mergedHost->getID());
+            }
+            multicastGroupTable->mergeHosts(merge.first->getID(), mergedIDs);
+
+            mergedHosts.insert(mergedHosts.end(), merge.second.begin(), merge.second.end());
+        }
+
+        removeHosts(mergedHosts, false);
+
+        // (mac & address index entries of the merged hosts went with them)
+        for (auto& merge : merges) {
+            onHostAddrUpdate(merge.first);
+        }
+    }
+
+    void NetEventManager::setHostTunnel(Host* host, NetEvent* ne, bool isSender) {
+        if (ne->tunnel == Tunnel::None || (host->getTunnel() == ne->tunnel && host->getTunnelID() == ne->tunnelID)) {
+            return;
+        }
+
+        Tins::IPv4Address endpointIPv4 = isSender ? ne->tunnelSrcAddrIPv4 : ne->tunnelDstAddrIPv4;
+        Tins::IPv6Address endpointIPv6 = isSender ? ne->tunnelSrcAddrIPv6 : ne->tunnelDstAddrIPv6;
+        std::string endpoint = "";
+        if (endpointIPv4 != NetUtil::zeroAddrIPv4) {
+            endpoint = endpointIPv4.to_string();
+        }
+        else if (endpointIPv6 != NetUtil::zeroAddrIPv6) {
+            endpoint = endpointIPv6.to_string();
+        }
+        host->setTunnel(ne->tunnel, ne->tunnelID, endpoint);
+    }
+
     void NetEventManager::addHost(Host *host) {
+        host->setVlanID(currentVlanID);
         setHostnameFromDNSAnswers(host);
+        requestReverseDNSLookup(host);
 
+        // (ids of evicted hosts are reused, id indexed tables stay bounded)
+        if (freeHostIDs.empty()) {
+            host->setID(nextHostID++);
+        }
+        else {
+            host->setID(freeHostIDs.back());
+            freeHostIDs.pop_back();
+        }
         hosts->push_back(host);
+        if (host->getID() >= hostsByID.size()) {
+            hostsByID.resize(host->getID() + 1, nullptr);
+        }
+        hostsByID[host->getID()] = host;
+        if (host->getAddrHW() != NetUtil::zeroAddrHW) {
+            hostsByHW.emplace(getHWKey(host->getAddrHW(), currentVlanID), host);
+        }
+        indexHostAddrs(host);
+
+        lruList.push_front(host);
+        host->setLRUIterator(lruList.begin());
+        host->setLastSeenTime(currentTime);
+
+        for (auto hostChangeTracker : hostChangeTrackers) {
+            hostChangeTracker->addHost(host);
+        }
 
         for (auto listener : pneListeners) {
             listener->onPreparedNetEventNewHost(host);
         }
+
+        checkEUI64Identity(host);
     }
 
     Host* NetEventManager::getHost(Tins::HWAddress<6> hwAddr) {
@@ -287,12 +1057,16 @@ namespace Netvisix {
             return nullptr;
         }
 
-        for (Host* h : *hosts) {
-            if (h->getAddrHW() == hwAddr) {
-                return h;
-            }
+        auto it = hostsByHW.find(getHWKey(hwAddr, currentVlanID));
+        return (it != hostsByHW.end() && it->second->getAddrHW() == hwAddr) ? it->second : nullptr;
+    }
+
+    NetEventManager::HWKey NetEventManager::getHWKey(const Tins::HWAddress<6>& hwAddr, unsigned int vlanID) {
+        uint64_t key = 0;
+        for (uint8_t byte : hwAddr) {
+            key = (key << 8) | byte;
         }
-        return nullptr;
+        return HWKey(vlanID, key);
     }
 
     Host* NetEventManager::getHost(Tins::IPv4Address ipv4Addr) {
@@ -300,12 +1074,12 @@ namespace Netvisix {
             return nullptr;
         }
 
-        for (Host* h : *hosts) {
-            if (h->getAddrIPv4(ipv4Addr) != NetUtil::zeroAddrIPv4) {
-                return h;
-            }
+        Host* aggregateHost = getAggregateHost(ipv4Addr);
+        if (aggregateHost != nullptr) {
+            return aggregateHost;
         }
-        return nullptr;
+
+        return getIndexedHost(AddrKey(ipv4Addr, currentVlanID));
     }
 
     Host* NetEventManager::getHost(Tins::IPv6Address ipv6Addr) {
@@ -313,12 +1087,65 @@ namespace Netvisix {
             return nullptr;
         }
 
-        for (Host* h : *hosts) {
-            if (h->getAddrIPv6(ipv6Addr) != NetUtil::zeroAddrIPv6) {
-                return h;
+        Host* aggregateHost = getAggregateHost(ipv6Addr);
+        if (aggregateHost != nullptr) {
+            return aggregateHost;
+        }
+
+        return getIndexedHost(AddrKey(ipv6Addr, currentVlanID));
+    }
+
+    void NetEventManager::indexHostAddrs(Host* host) {
+        // (not yet added hosts are indexed by addHost)
+        if (host->getID() >= hostsByID.size() || hostsByID[host->getID()] != host) {
+            return;
+        }
+
+        auto index = [this, host](const AddrKey& key) {
+            auto range = hostsByAddr.equal_range(key);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == host) {
+                    return;
+                }
             }
+            hostsByAddr.emplace(key, host);
+        };
+        for (const Tins::IPv4Address& ipv4Addr : host->getAddrListIPv4()) {
+            index(AddrKey(ipv4Addr, host->getVlanID()));
+        }
+        for (const Tins::IPv6Address& ipv6Addr : host->getAddrListIPv6()) {
+            index(AddrKey(ipv6Addr, host->getVlanID()));
         }
-        return nullptr;
+    }
+
+    void NetEventManager::unindexHostAddrs(Host* host) {
+        auto unindex = [this, host](const AddrKey& key) {
+            auto range = hostsByAddr.equal_range(key);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == host) {
+                    hostsByAddr.erase(it);
+                    return;
+                }
+            }
+        };
+        for (const Tins::IPv4Address& ipv4Addr : host->getAddrListIPv4()) {
+            unindex(AddrKey(ipv4Addr, host->getVlanID()));
+        }
+        for (const Tins::IPv6Address& ipv6Addr : host->getAddrListIPv6()) {
+            unindex(AddrKey(ipv6Addr, host->getVlanID()));
+        }
+    }
+
+    Host* NetEventManager::getIndexedHost(const AddrKey& key) {
+        // (lowest id if two hosts hold the address, stable until they are merged)
+        Host* host = nullptr;
+        auto range = hostsByAddr.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (host == nullptr || it->second->getID() < host->getID()) {
+                host = it->second;
+            }
+        }
+        return host;
     }
 
     Host* NetEventManager::getHost(Tins::HWAddress<6> hwAddr, Tins::IPv4Address ipv4Addr, Tins::IPv6Address ipv6Addr) {
@@ -337,42 +1164,238 @@ namespace Netvisix {
         }
     }
 
-    bool NetEventManager::getIsHostInSubnet(Tins::IPv4Address ipv4Addr) {
-        if (ipv4Addr == NetUtil::zeroAddrIPv4) {
-            return false;
+    void NetEventManager::setLocalSubnets(std::string subnetsIPv4, std::string subnetsIPv6) {
+        localSubnets.clear();
+        localSubnetTableIPv4->clear();
+        localSubnetTableIPv6->clear();
+        vlanSubnetTableIPv4->clear();
+        vlanSubnetTableIPv6->clear();
+        hasVlanSubnets = false;
+
+        for (const std::string& entry : NetUtil::getSubnetListEntries(subnetsIPv4)) {
+            std::string subnet = NetUtil::getSubnetListEntrySubnet(entry);
+            if (NetUtil::getIsSubnetStringIPv4Valid(subnet) == false) {
+                continue;
+            }
+
+            Tins::IPv4Address addr(NetUtil::getSubnetAddrStringIPv4(subnet));
+            int prefix = NetUtil::getSubnetPrefix(subnet);
+
+            LocalSubnet localSubnet;
+            localSubnet.name = NetUtil::getSubnetListEntryName(entry);
+            localSubnet.lastAddrIPv4 = *(addr / prefix).end();
+            localSubnets.push_back(localSubnet);
+
+            // (network byte order, behind the vlan id for vlan subnets)
+            uint8_t key[3 + 4];
+            int vlanID = NetUtil::getSubnetListEntryVlanID(entry);
+            setVlanKey(key, vlanID);
+            uint32_t addrRaw = addr;
+            std::memcpy(key + 3, &addrRaw, 4);
+            if (vlanID >= 0) {
+                vlanSubnetTableIPv4->insert(key, 24 + prefix, localSubnets.size() - 1);
+                hasVlanSubnets = true;
+            }
+            else {
+                localSubnetTableIPv4->insert(key + 3, prefix, localSubnets.size() - 1);
+            }
         }
 
-        if (subnetIPv4.contains(ipv4Addr) && (*subnetIPv4.end()) != ipv4Addr) {
-            return true;
+        // link local addresses (not editable by user), user subnets with a longer prefix win
+        std::string subnetsIPv6WithLinkLocal = "link-local=fe80::/10," + subnetsIPv6;
+        for (const std::string& entry : NetUtil::getSubnetListEntries(subnetsIPv6WithLinkLocal)) {
+            std::string subnet = NetUtil::getSubnetListEntrySubnet(entry);
+            if (NetUtil::getIsSubnetStringIPv6Valid(subnet) == false) {
+                continue;
+            }
+
+            Tins::IPv6Address addr(NetUtil::getSubnetAddrStringIPv6(subnet));
+            int prefix = NetUtil::getSubnetPrefix(subnet);
+
+            LocalSubnet localSubnet;
+            localSubnet.name = NetUtil::getSubnetListEntryName(entry);
+            localSubnet.lastAddrIPv6 = *(addr / prefix).end();
+            localSubnets.push_back(localSubnet);
+
+            uint8_t key[3 + 16];
+            int vlanID = NetUtil::getSubnetListEntryVlanID(entry);
+            setVlanKey(key, vlanID);
+            std::memcpy(key + 3, addr.begin(), 16);
+            if (vlanID >= 0) {
+                vlanSubnetTableIPv6->insert(key, 24 + prefix, localSubnets.size() - 1);
+                hasVlanSubnets = true;
+            }
+            else {
+                localSubnetTableIPv6->insert(key + 3, prefix, localSubnets.size() - 1);
+            }
         }
-        else {
+    }
+
+    void NetEventManager::setVlanKey(uint8_t* key, int vlanID) {
+        key[0] = (vlanID >> 16) & 0xff;
+        key[1] = (vlanID >> 8) & 0xff;
+        key[2] = vlanID & 0xff;
+    }
+
+    int NetEventManager::getLocalSubnetIndex(Tins::IPv4Address ipv4Addr, unsigned int vlanID) {
+        uint8_t key[3 + 4];
+        setVlanKey(key, vlanID);
+        uint32_t addrRaw = ipv4Addr;
+        std::memcpy(key + 3, &addrRaw, 4);
+
+        int index = hasVlanSubnets ? vlanSubnetTableIPv4->lookup(key) : -1;
+        return (index >= 0) ? index : localSubnetTableIPv4->lookup(key + 3);
+    }
+
+    int NetEventManager::getLocalSubnetIndex(Tins::IPv6Address ipv6Addr, unsigned int vlanID) {
+        uint8_t key[3 + 16];
+        setVlanKey(key, vlanID);
+        std::memcpy(key + 3, ipv6Addr.begin(), 16);
+
+        int index = hasVlanSubnets ? vlanSubnetTableIPv6->lookup(key) : -1;
+        return (index >= 0) ? index : localSubnetTableIPv6->lookup(key + 3);
+    }
+
+    bool NetEventManager::getIsHostInSubnet(Tins::IPv4Address ipv4Addr) {
+        if (ipv4Addr == NetUtil::zeroAddrIPv4) {
             return false;
         }
+
+        int index = getLocalSubnetIndex(ipv4Addr, currentVlanID);
+        return (index >= 0 && localSubnets[index].lastAddrIPv4 != ipv4Addr);
     }
 
     bool NetEventManager::getIsHostInSubnet(Tins::IPv6Address ipv6Addr) {
         if (ipv6Addr == NetUtil::zeroAddrIPv6) {
             return false;
         }
-        // unique local unicast (editable by user (as ipv4 subnet))
-        if (subnetIPv6UniqueLocal.contains(ipv6Addr) && (*subnetIPv6UniqueLocal.end()) != ipv6Addr) {
-            return true;
+
+        int index = getLocalSubnetIndex(ipv6Addr, currentVlanID);
+        return (index >= 0 && localSubnets[index].lastAddrIPv6 != ipv6Addr);
+    }
+
+    bool NetEventManager::getIsSubnetBroadcastAddr(Tins::IPv4Address ipv4Addr) {
+        int index = getLocalSubnetIndex(ipv4Addr, currentVlanID);
+        return (index >= 0 && localSubnets[index].lastAddrIPv4 == ipv4Addr);
+    }
+
+    std::string NetEventManager::getSubnetName(Tins::IPv4Address ipv4Addr, unsigned int vlanID) {
+        std::string name = "";
+
+        mutex.lock();
+        int index = getLocalSubnetIndex(ipv4Addr, vlanID);
+        if (index >= 0 && localSubnets[index].lastAddrIPv4 != ipv4Addr) {
+            name = localSubnets[index].name;
         }
+        mutex.unlock();
+
+        return name;
+    }
 
-        // link local address (not editable by user)
-        if (subnetIPv6LinkLocal.contains(ipv6Addr) && (*subnetIPv6LinkLocal.end()) != ipv6Addr) {
-            return true;
+    std::string NetEventManager::getSubnetName(Tins::IPv6Address ipv6Addr, unsigned int vlanID) {
+        std::string name = "";
+
+        mutex.lock();
+        int index = getLocalSubnetIndex(ipv6Addr, vlanID);
+        if (index >= 0 && localSubnets[index].lastAddrIPv6 != ipv6Addr) {
+            name = localSubnets[index].name;
+        }
+        mutex.unlock();
+
+        return name;
+    }
+
+    std::vector<unsigned int> NetEventManager::getVlanIDs() {
+        std::vector<unsigned int> vlanIDs;
+
+        mutex.lock();
+        for (auto& vlanStatistic : vlanStatistics) {
+            vlanIDs.push_back(vlanStatistic.first);
+        }
+        mutex.unlock();
+
+        std::sort(vlanIDs.begin(), vlanIDs.end());
+        return vlanIDs;
+    }
+
+    bool NetEventManager::getVlanCounters(unsigned int vlanID, unsigned long long& frames, unsigned long long& bytes) {
+        mutex.lock();
+        auto it = vlanStatistics.find(vlanID);
+        NetStatistic::Item* item = (it != vlanStatistics.end()) ? it->second->getItem(IPVersion::ALL, Protocol::EthernetII) : nullptr;
+        if (item != nullptr) {
+            frames = item->framesSnt;
+            bytes = item->bytesSnt;
+        }
+        mutex.unlock();
+
+        return item != nullptr;
+    }
+
+    std::vector<std::pair<Tunnel, uint32_t>> NetEventManager::getTunnels() {
+        std::vector<std::pair<Tunnel, uint32_t>> tunnels;
+
+        mutex.lock();
+        for (auto& tunnelStatistic : tunnelStatistics) {
+            tunnels.push_back(tunnelStatistic.first);
+        }
+        mutex.unlock();
+
+        return tunnels;
+    }
+
+    bool NetEventManager::getTunnelCounters(Tunnel tunnel, uint32_t tunnelID, unsigned long long& frames, unsigned long long& bytes) {
+        mutex.lock();
+        auto it = tunnelStatistics.find(std::make_pair(tunnel, tunnelID));
+        NetStatistic::Item* item = (it != tunnelStatistics.end()) ? it->second->getItem(IPVersion::ALL, Protocol::EthernetII) : nullptr;
+        if (item != nullptr) {
+            frames = item->framesSnt;
+            bytes = item->bytesSnt;
+        }
+        mutex.unlock();
+
+        return item != nullptr;
+    }
+
+    std::vector<uint16_t> NetEventManager::getOpenPorts(Host* host, bool isUDP) {
+        mutex.lock();
+        std::vector<uint16_t> ports = host->getOpenPorts(isUDP).getPorts();
+        mutex.unlock();
+
+        return ports;
+    }
+
+    std::vector<Host*> NetEventManager::getHostsWithOpenPort(uint16_t port, bool isUDP) {
+        std::vector<Host*> hostsWithPort;
+
+        mutex.lock();
+        for (Host* host : *hosts) {
+            if (host->getOpenPorts(isUDP).contains(port)) {
+                hostsWithPort.push_back(host);
+            }
         }
+        mutex.unlock();
+
+        return hostsWithPort;
+    }
 
-        return false;
+    unsigned int NetEventManager::getMulticastGroupCount() {
+        mutex.lock();
+        unsigned int groupCount = multicastGroupTable->getGroupCount();
+        mutex.unlock();
+
+        return groupCount;
     }
 
-    Tins::IPv4Address NetEventManager::getSubnetBroadcastAddrIPv4() {
-        return (*subnetIPv4.end());
+    unsigned long NetEventManager::getEvictedBindingCount() {
+        mutex.lock();
+        unsigned long evictedBindingCount = bindingTable->getEvictedCount();
+        mutex.unlock();
+
+        return evictedBindingCount;
     }
 
     void NetEventManager::handleNewHosts(NetEvent *ne) {
-        if (ne->l1Protocol != Protocol::EthernetII) {
+        if (ne->l1Protocol == Protocol::Unkown) {
             return;
         }
 
@@ -418,7 +1441,14 @@ namespace Netvisix {
 
         Host* hIP = getHost(ipv4Addr);
         if (hIP == nullptr) {
-            if (getIsHostInSubnet(ipv4Addr)) {
+            // (arp / ndp bound addresses are on link, take the announced mac)
+            Tins::HWAddress<6> boundAddrHW = bindingTable->get(ipv4Addr, currentVlanID);
+            if (boundAddrHW != NetUtil::zeroAddrHW && addrTypeIP == AddrType::UNICAST) {
+                hwAddr = boundAddrHW;
+                addrTypeHW = AddrType::UNICAST;
+            }
+
+            if (boundAddrHW != NetUtil::zeroAddrHW || getIsHostInSubnet(ipv4Addr)) {
                 Host* hHW = getHost(hwAddr);
                 if (hHW == nullptr) {
                     // in lan / ip and hw not in list / add new host
@@ -440,13 +1470,18 @@ namespace Netvisix {
                 }
             }
             else if (addrTypeIP == AddrType::UNICAST) {
-                // not in lan / ip not in list (do not handle hw) / add new host
-                Host* nHost = new Host();
-                nHost->addAddrIPv4(ipv4Addr, false);
-                nHost->setNetArea(NetArea::OUTSIDE_SUBNET);
-                addHost(nHost);
+                // not in lan / ip not in list (do not handle hw) / add new host (or prefix)
+                if (aggregationPrefixIPv4 == 0 || addAggregateHost(ipv4Addr) == nullptr) {
+                    Host* nHost = new Host();
+                    nHost->addAddrIPv4(ipv4Addr, false);
+                    nHost->setNetArea(NetArea::OUTSIDE_SUBNET);
+                    addHost(nHost);
+                }
             }
         }
+        else if (hIP->getIsAggregate()) {
+            hIP->addAggregateMember(ipv4Addr);
+        }
     }
 
     void NetEventManager::checkNewHost(Tins::HWAddress<6> hwAddr, Tins::IPv6Address ipv6Addr) {
@@ -458,7 +1493,14 @@ namespace Netvisix {
 
         Host* hIP = getHost(ipv6Addr);
         if (hIP == nullptr) {
-            if (getIsHostInSubnet(ipv6Addr)) {
+            // (arp / ndp bound addresses are on link, take the announced mac)
+            Tins::HWAddress<6> boundAddrHW = bindingTable->get(ipv6Addr, currentVlanID);
+            if (boundAddrHW != NetUtil::zeroAddrHW && addrTypeIP == AddrType::UNICAST) {
+                hwAddr = boundAddrHW;
+                addrTypeHW = AddrType::UNICAST;
+            }
+
+            if (boundAddrHW != NetUtil::zeroAddrHW || getIsHostInSubnet(ipv6Addr)) {
                 Host* hHW = getHost(hwAddr);
                 if (hHW == nullptr) {
                     // in lan / ip and hw not in list / add new host
@@ -480,13 +1522,18 @@ namespace Netvisix {
                 }
             }
             else if (addrTypeIP == AddrType::UNICAST) {
-                // not in lan / ip not in list (do not handle hw) / add new host
-                Host* nHost = new Host();
-                nHost->addAddrIPv6(ipv6Addr, false);
-                nHost->setNetArea(NetArea::OUTSIDE_SUBNET);
-                addHost(nHost);
+                // not in lan / ip not in list (do not handle hw) / add new host (or prefix)
+                if (aggregationPrefixIPv6 == 0 || addAggregateHost(ipv6Addr) == nullptr) {
+                    Host* nHost = new Host();
+                    nHost->addAddrIPv6(ipv6Addr, false);
+                    nHost->setNetArea(NetArea::OUTSIDE_SUBNET);
+                    addHost(nHost);
+                }
             }
         }
+        else if (hIP->getIsAggregate()) {
+            hIP->addAggregateMember(ipv6Addr);
+        }
     }
 
     AddrType NetEventManager::getAddrType(Tins::HWAddress<6> hwAddr) {
@@ -507,7 +1554,7 @@ namespace Netvisix {
             return AddrType::UNKOWN;
         }
 
-        if (ipv4Addr.is_broadcast() || ipv4Addr.is_multicast() || ipv4Addr == getSubnetBroadcastAddrIPv4()) {
+        if (ipv4Addr.is_broadcast() || ipv4Addr.is_multicast() || getIsSubnetBroadcastAddr(ipv4Addr)) {
             return AddrType::MULTICAST;
         }
         else {
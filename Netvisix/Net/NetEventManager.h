@@ -22,18 +22,36 @@
 
 #include <string>
 #include <vector>
-#include <ctime>
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstdint>
 
 #include <tins.h>
 
+#include "Net/AddrKey.h"
+
 
 namespace Netvisix {
 
     class NetEvent;
     enum class AddrType;
+    enum class Tunnel;
     class Host;
     class IPreparedNetEventListener;
     class PacketHandler;
+    class HostChangeTracker;
+    class IHostRemovalListener;
+    class NetStatistic;
+    class PrefixTable;
+    class DNSCache;
+    class BindingTable;
+    class IdentityResolver;
+    class MulticastGroupTable;
+    class AnomalyDetector;
+    class ReverseDNSService;
 
     enum class NetArea {
         LOCAL_INTERFACE,
@@ -52,16 +70,55 @@ namespace Netvisix {
 
             void reset();
 
-            void startSniffing(std::string interfaceName, bool promiscMode, std::string subnetIPv4, std::string subnetIPv6);
+            // (subnet lists as accepted by NetUtil::getSubnetListEntries)
+            void startSniffing(std::string interfaceName, bool promiscMode, std::string subnetsIPv4, std::string subnetsIPv6);
             void stopSniffing();
             bool getIsSniffingRunning();
 
             void handleNetEvent(NetEvent* ne);
 
-            void handleDNSAnswer(std::string ipAddr, std::string hostname);
+            // (capture thread, ttl in seconds, vlan of the answer packet)
+            // addr: 4 or 16 bytes in network byte order
+            void handleDNSAnswer(const uint8_t* addr, unsigned int addrLength, const char* hostname, uint32_t ttl, unsigned int vlanID);
+            void handleNameRelease(const uint8_t* addr, unsigned int addrLength, const char* hostname, unsigned int vlanID);
+
+            // lookups of hosts without a name, on enabling & for new hosts
+            void setReverseDNSLookupEnabled(bool enabled);
+            bool getReverseDNSLookupEnabled() { return this->reverseDNSLookupEnabled; }
+            ReverseDNSService* getReverseDNSService() { return this->reverseDNSService; }
 
             void addPreparedNetEventListener(IPreparedNetEventListener* listener) { this->pneListeners.push_back(listener); }
 
+            // (owned by the manager, drained by one consumer thread)
+            HostChangeTracker* createHostChangeTracker();
+
+            void addHostRemovalListener(IHostRemovalListener* listener);
+            void removeHostRemovalListener(IHostRemovalListener* listener);
+
+            // idle & lru eviction (gui thread, about once per second), consumerMemoryUsage: memory of all host
+            // dependent gui objects, counted against the budget together with the host table
+            void evictHosts(size_t consumerMemoryUsage);
+
+            size_t getMemoryBudget() { return this->memoryBudget; }
+            void setMemoryBudget(size_t memoryBudget) { this->memoryBudget = memoryBudget; }
+
+            size_t getMemoryUsage() { return this->memoryUsage; }
+            unsigned int getHostCount() { return this->hosts->size(); }
+
+            // collapse outside subnet addresses into one host per prefix (0 = off), new hosts only
+            void setAggregationPrefixes(unsigned int prefixIPv4, unsigned int prefixIPv6);
+            unsigned int getAggregationPrefixIPv4() { return this->aggregationPrefixIPv4; }
+            unsigned int getAggregationPrefixIPv6() { return this->aggregationPrefixIPv6; }
+
+            // drill-down (gui thread), replaces the aggregate by its member hosts
+            void expandAggregateHost(Host* host);
+
+            // aggregated statistic of evicted hosts (SUBNET / OUTSIDE_SUBNET)
+            NetStatistic* getOtherStatistic(NetArea netArea);
+            // (frames & bytes sent + received, copied under the lock)
+            void getOtherCounters(NetArea netArea, unsigned long long& frames, unsigned long long& bytes);
+            unsigned long getEvictedHostCount() { return this->evictedHostCount; }
+
             bool getIsPaused() { return this->isPaused; }
             void setIsPaused(bool paused) { this->isPaused = paused; }
 
@@ -69,20 +126,50 @@ namespace Netvisix {
 
             bool getIsLocalInterface(Host* h);
 
+            // name of the local subnet containing the address ("" if outside)
+            std::string getSubnetName(Tins::IPv4Address ipv4Addr, unsigned int vlanID);
+            std::string getSubnetName(Tins::IPv6Address ipv6Addr, unsigned int vlanID);
+
+            // traffic per vlan (0 = untagged), counters copied under the lock (false if unknown)
+            std::vector<unsigned int> getVlanIDs();
+            bool getVlanCounters(unsigned int vlanID, unsigned long long& frames, unsigned long long& bytes);
+
+            // traffic per tunnel (type, id) of decapsulated frames
+            std::vector<std::pair<Tunnel, uint32_t>> getTunnels();
+            bool getTunnelCounters(Tunnel tunnel, uint32_t tunnelID, unsigned long long& frames, unsigned long long& bytes);
+
+            // passive service inventory (ascending ports), and all hosts answering on a port
+            std::vector<uint16_t> getOpenPorts(Host* host, bool isUDP);
+            std::vector<Host*> getHostsWithOpenPort(uint16_t port, bool isUDP);
+
+            // multicast groups with igmp / mld members (all vlans)
+            unsigned int getMulticastGroupCount();
+            // (learned bindings dropped from the full binding table)
+            unsigned long getEvictedBindingCount();
+
             void onHostAddrUpdate(Host* host);
 
         private:
-            struct DNSAnswer {
-                std::string ipAddr;
-                std::string hostname;
-                std::clock_t timeStamp;
-            };
-
             NetEventManager();
 
             void handleNewHosts(NetEvent* ne);
+            // (arp / ndp ip -> mac bindings, attach the address to the known host of the other one)
+            void handleBinding(NetEvent* ne);
+
+            // identity evidence, the hosts are merged on the next evictHosts (see IdentityResolver)
+            void uniteHosts(Host* hostA, Host* hostB);
+            void checkEUI64Identity(Host* host);
+            void applyHostMerges();
 
             void handleNewPackets(NetEvent* ne);
+            void handleServerName(NetEvent* ne);
+            void handleGroupReports(NetEvent* ne);
+            // (multicast traffic to the igmp / mld members of the destination group)
+            void handleGroupMembers(Host* sender, NetEvent* ne);
+            // scans & floods (see AnomalyDetector), receiver is nullptr for multicast
+            void handleAnomalies(Host* sender, Host* receiver, NetEvent* ne);
+            // (outer endpoint on the side of the host)
+            void setHostTunnel(Host* host, NetEvent* ne, bool isSender);
 
             Host* getHost(Tins::HWAddress<6> hwAddr);
             Host* getHost(Tins::IPv4Address ipv4Addr);
@@ -91,13 +178,51 @@ namespace Netvisix {
 
             void addHost(Host* host);
 
+            void setHostDirty(Host* host);
+            void touchHost(Host* host);
+
+            // (only evicted hosts are rolled up into "other", counted and leave their multicast groups,
+            // merged and expanded hosts live on in others)
+            void removeHosts(const std::vector<Host*>& hostsToRemove, bool isEviction);
+
+            Host* getAggregateHost(Tins::IPv4Address ipv4Addr);
+            Host* getAggregateHost(Tins::IPv6Address ipv6Addr);
+            Host* addAggregateHost(Tins::IPv4Address ipv4Addr);
+            Host* addAggregateHost(Tins::IPv6Address ipv6Addr);
+            // (vlan, prefix)
+            typedef std::pair<unsigned int, uint64_t> AggregateKey;
+            struct AggregateKeyHash {
+                size_t operator()(const AggregateKey& key) const { return std::hash<uint64_t>()(key.second ^ ((uint64_t) key.first << 40)); }
+            };
+
+            // (vlan, mac)
+            typedef std::pair<unsigned int, uint64_t> HWKey;
+            static HWKey getHWKey(const Tins::HWAddress<6>& hwAddr, unsigned int vlanID);
+
+            // (hostsByAddr entries for all addresses of a registered host, missing ones only)
+            void indexHostAddrs(Host* host);
+            void unindexHostAddrs(Host* host);
+            Host* getIndexedHost(const AddrKey& key);
+
+            static AggregateKey getAggregateKey(Tins::IPv4Address prefix, unsigned int prefixLength, unsigned int vlanID);
+            static AggregateKey getAggregateKey(Tins::IPv6Address prefix, unsigned int prefixLength, unsigned int vlanID);
+            AggregateKey getAggregateKey(Host* aggregateHost);
+
+            static long long getCurrentTime();
+
             void checkNewHost(Tins::HWAddress<6> hwAddr, Tins::IPv4Address ipv4Addr);
             void checkNewHost(Tins::HWAddress<6> hwAddr, Tins::IPv6Address ipv6Addr);
 
             bool getIsHostInSubnet(Tins::IPv4Address ipv4Addr);
             bool getIsHostInSubnet(Tins::IPv6Address ipv6Addr);
 
-            Tins::IPv4Address getSubnetBroadcastAddrIPv4();
+            // index into localSubnets (longest prefix match, subnets of the vlan before the global ones) or -1
+            int getLocalSubnetIndex(Tins::IPv4Address ipv4Addr, unsigned int vlanID);
+            int getLocalSubnetIndex(Tins::IPv6Address ipv6Addr, unsigned int vlanID);
+
+            static void setVlanKey(uint8_t* key, int vlanID);
+
+            bool getIsSubnetBroadcastAddr(Tins::IPv4Address ipv4Addr);
 
             AddrType getAddrType(Tins::HWAddress<6> hwAddr);
             AddrType getAddrType(Tins::IPv4Address ipv4Addr);
@@ -109,28 +234,95 @@ namespace Netvisix {
 
             void handleNetAreaSubnet(Host* host);
 
-            void removeOldDNSAnswers();
+            void setLocalSubnets(std::string subnetsIPv4, std::string subnetsIPv6);
+
             void setHostnameFromDNSAnswers(Host* host);
 
+            void requestReverseDNSLookup(Host* host);
+            void handleReverseDNSAnswer(const std::string& ipAddr, const std::string& hostname);
+            static void onReverseDNSAnswer(const std::string& ipAddr, const std::string& hostname);
+
             static NetEventManager* instance;
 
             PacketHandler* packetHandler;
 
             std::vector<Host*>* hosts;
+            // (nullptr for free ids)
+            std::vector<Host*> hostsByID;
+            unsigned int nextHostID;
+            std::vector<unsigned int> freeHostIDs;
+
+            // capture thread (handleNetEvent) vs. eviction
+            std::mutex mutex;
+
+            // (most recently seen first)
+            std::list<Host*> lruList;
+            long long currentTime;
+
+            size_t memoryBudget;
+            size_t memoryUsage;
+
+            unsigned int aggregationPrefixIPv4;
+            unsigned int aggregationPrefixIPv6;
+            Tins::IPv4Address aggregationMaskIPv4;
+            Tins::IPv6Address aggregationMaskIPv6;
+            std::unordered_map<AggregateKey, Host*, AggregateKeyHash> aggregateHosts;
+            std::unordered_set<AggregateKey, AggregateKeyHash> expandedPrefixes;
+
+            // hosts by mac (kept in addHost, onHostAddrUpdate & removeHosts)
+            std::unordered_map<HWKey, Host*, AggregateKeyHash> hostsByHW;
+
+            // hosts by (vlan, ip address), kept like hostsByHW (an address may be held by two hosts until they are merged)
+            std::unordered_multimap<AddrKey, Host*, AddrKeyHash> hostsByAddr;
+
+            // vlan of the event being handled (host lookups, subnets & new hosts are per vlan)
+            unsigned int currentVlanID;
+            std::unordered_map<unsigned int, NetStatistic*> vlanStatistics;
+            std::map<std::pair<Tunnel, uint32_t>, NetStatistic*> tunnelStatistics;
+
+            NetStatistic* otherStatisticSubnet;
+            NetStatistic* otherStatisticOutsideSubnet;
+            unsigned long evictedHostCount;
             unsigned long netEventCounter;
 
             std::vector<IPreparedNetEventListener*> pneListeners;
+            std::vector<HostChangeTracker*> hostChangeTrackers;
+            std::vector<IHostRemovalListener*> hostRemovalListeners;
+
+            struct LocalSubnet {
+                std::string name;
+                // (last address of the range, the broadcast address for ipv4)
+                Tins::IPv4Address lastAddrIPv4;
+                Tins::IPv6Address lastAddrIPv6;
+            };
 
-            const Tins::AddressRange<Tins::IPv6Address> subnetIPv6LinkLocal = Tins::IPv6Address("fe80::") / 10;
-
-            Tins::AddressRange<Tins::IPv6Address> subnetIPv6UniqueLocal = Tins::IPv6Address("fd00::") / 8;
-            Tins::AddressRange<Tins::IPv4Address> subnetIPv4 = Tins::IPv4Address("0.0.0.0") / 32;
+            std::vector<LocalSubnet> localSubnets;
+            PrefixTable* localSubnetTableIPv4;
+            PrefixTable* localSubnetTableIPv6;
+            // (keys: 3 bytes vlan id + address)
+            PrefixTable* vlanSubnetTableIPv4;
+            PrefixTable* vlanSubnetTableIPv6;
+            bool hasVlanSubnets;
 
             bool isPaused;
 
             Host* hostLocalInterface;
 
-            std::vector<DNSAnswer*>* dnsAnswers;
+            DNSCache* dnsCache;
+            BindingTable* bindingTable;
+            IdentityResolver* identityResolver;
+            MulticastGroupTable* multicastGroupTable;
+            AnomalyDetector* anomalyDetector;
+
+            ReverseDNSService* reverseDNSService;
+            bool reverseDNSLookupEnabled;
+
+            const size_t MEMORY_BUDGET_DEFAULT = 256 * 1024 * 1024;
+            const long long HOST_IDLE_TIMEOUT = 30 * 60 * 1000;
+            // (anomaly marker shown after the last detection)
+            const long long ANOMALY_HOLD_TIME = 60 * 1000;
+            // (evict down to this fraction of the budget)
+            const float EVICTION_TARGET = 0.9f;
     };
 
 } // namespace Netvisix
@@ -18,11 +18,13 @@
  */
 
 #include "NetStatistic.h"
+#include "Net/ServiceTable.h"
 
 namespace Netvisix {
 
     NetStatistic::NetStatistic() {
         items = new std::vector<Item*>();
+        serviceItems = nullptr;
 
         addProtocol(IPVersion::ALL, Layer::L1, Protocol::EthernetII);
         addProtocol(IPVersion::ALL, Layer::L1, Protocol::Unkown);
@@ -47,6 +49,7 @@ namespace Netvisix {
             delete items->at(i);
         }
         delete items;
+        delete[] serviceItems;
     }
 
     NetStatistic::Item* NetStatistic::getItem(IPVersion ipVersion, Protocol protocol) {
@@ -61,6 +64,81 @@ namespace Netvisix {
         return nullptr;
     }
 
+    NetStatistic::Item* NetStatistic::getServiceItem(Service service) {
+        if (serviceItems == nullptr) {
+            return nullptr;
+        }
+
+        return &serviceItems[(unsigned int) service];
+    }
+
+    void NetStatistic::createServiceItems() {
+        serviceItems = new Item[ServiceTable::SERVICE_COUNT];
+        for (unsigned int i = 0; i < ServiceTable::SERVICE_COUNT; i++) {
+            serviceItems[i].ipVersion = IPVersion::ALL;
+            serviceItems[i].layer = Layer::L3;
+            serviceItems[i].protocol = Protocol::Unkown;
+        }
+    }
+
+    void NetStatistic::add(NetStatistic* other) {
+        // (both statistics have the same items in the same order)
+        unsigned int itemsSize = items->size();
+        for (unsigned int i = 0; i < itemsSize; i++) {
+            Item* item = items->at(i);
+            Item* otherItem = other->items->at(i);
+            item->framesSnt += otherItem->framesSnt;
+            item->framesRcv += otherItem->framesRcv;
+            item->bytesSnt += otherItem->bytesSnt;
+            item->bytesRcv += otherItem->bytesRcv;
+        }
+
+        if (other->serviceItems != nullptr) {
+            if (serviceItems == nullptr) {
+                createServiceItems();
+            }
+            for (unsigned int i = 0; i < ServiceTable::SERVICE_COUNT; i++) {
+                serviceItems[i].framesSnt += other->serviceItems[i].framesSnt;
+                serviceItems[i].framesRcv += other->serviceItems[i].framesRcv;
+                serviceItems[i].bytesSnt += other->serviceItems[i].bytesSnt;
+                serviceItems[i].bytesRcv += other->serviceItems[i].bytesRcv;
+            }
+        }
+    }
+
+    void NetStatistic::add(NetStatistic* other, unsigned int part, unsigned int partCount) {
+        auto share = [part, partCount](unsigned long long value) {
+            return value / partCount + ((part < value % partCount) ? 1 : 0);
+        };
+
+        unsigned int itemsSize = items->size();
+        for (unsigned int i = 0; i < itemsSize; i++) {
+            Item* item = items->at(i);
+            Item* otherItem = other->items->at(i);
+            item->framesSnt += share(otherItem->framesSnt);
+            item->framesRcv += share(otherItem->framesRcv);
+            item->bytesSnt += share(otherItem->bytesSnt);
+            item->bytesRcv += share(otherItem->bytesRcv);
+        }
+
+        if (other->serviceItems != nullptr) {
+            if (serviceItems == nullptr) {
+                createServiceItems();
+            }
+            for (unsigned int i = 0; i < ServiceTable::SERVICE_COUNT; i++) {
+                serviceItems[i].framesSnt += share(other->serviceItems[i].framesSnt);
+                serviceItems[i].framesRcv += share(other->serviceItems[i].framesRcv);
+                serviceItems[i].bytesSnt += share(other->serviceItems[i].bytesSnt);
+                serviceItems[i].bytesRcv += share(other->serviceItems[i].bytesRcv);
+            }
+        }
+    }
+
+    size_t NetStatistic::getMemoryUsage() {
+        return sizeof(NetStatistic) + sizeof(std::vector<Item*>) + items->capacity() * sizeof(Item*) + items->size() * sizeof(Item)
+                + ((serviceItems != nullptr) ? ServiceTable::SERVICE_COUNT * sizeof(Item) : 0);
+    }
+
     void NetStatistic::addProtocol(IPVersion ipVersion, Layer layer, Protocol protocol) {
         Item* item = new Item();
         item->ipVersion = ipVersion;
@@ -74,7 +152,13 @@ namespace Netvisix {
         for (unsigned int i = 0; i < itemsSize; i++) {
             Item* item = items->at(i);
 
-            if (netEvent->getProtocol(item->layer) == item->protocol) {
+            Protocol protocol = netEvent->getProtocol(item->layer);
+            // (the frames item counts every decoded link type, not only ethernet II)
+            if (item->layer == Layer::L1 && protocol != Protocol::Unkown) {
+                protocol = Protocol::EthernetII;
+            }
+
+            if (protocol == item->protocol) {
 
                 if (item->ipVersion == IPVersion::ALL
                         || (netEvent->isIPv4() && item->ipVersion == IPVersion::IPV4)
@@ -85,6 +169,13 @@ namespace Netvisix {
                 }
             }
         }
+
+        if (netEvent->service != Service::None) {
+            if (serviceItems == nullptr) {
+                createServiceItems();
+            }
+            handleTrafficDirection(trafficDirection, &serviceItems[(unsigned int) netEvent->service], netEvent);
+        }
     }
 
     void NetStatistic::handleTrafficDirection(TrafficDirection trafficDirection, Item *item, NetEvent *ne) {
@@ -60,10 +60,23 @@ namespace Netvisix {
 
             Item* getItem(IPVersion ipVersion, Protocol protocol);
 
+            // (nullptr until a known service was counted)
+            Item* getServiceItem(Service service);
+
+            void add(NetStatistic* other);
+            // (share part of partCount, the shares of all parts add up to other)
+            void add(NetStatistic* other, unsigned int part, unsigned int partCount);
+
+            size_t getMemoryUsage();
+
         private:
             std::vector<Item*>* items;
 
+            // one item per service, indexed by Service (nullptr until a known service is seen)
+            Item* serviceItems;
+
             void handleTrafficDirection(TrafficDirection trafficDirection, Item* item, NetEvent* ne);
+            void createServiceItems();
     };
 
 } // namespace Netvisix
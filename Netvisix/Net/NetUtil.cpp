@@ -22,6 +22,11 @@
 #include <exception>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 
 namespace Netvisix {
@@ -69,6 +74,89 @@ namespace Netvisix {
         }
     }
 
+    std::vector<std::string> NetUtil::getSubnetListEntries(std::string subnetList) {
+        std::vector<std::string> entries;
+
+        std::stringstream ss(subnetList);
+        std::string entry;
+        while (std::getline(ss, entry, ',')) {
+            // trim whitespaces
+            size_t first = entry.find_first_not_of(" \t");
+            if (first == std::string::npos) {
+                continue;
+            }
+            size_t last = entry.find_last_not_of(" \t");
+            entries.push_back(entry.substr(first, last - first + 1));
+        }
+
+        return entries;
+    }
+
+    std::string NetUtil::getSubnetListEntryName(std::string entry) {
+        size_t equalPos = entry.find('=');
+        size_t namePos = std::min(entry.find('@'), equalPos);
+        if (equalPos == std::string::npos || namePos == 0) {
+            return getSubnetListEntrySubnet(entry);
+        }
+
+        return entry.substr(0, namePos);
+    }
+
+    int NetUtil::getSubnetListEntryVlanID(std::string entry) {
+        size_t equalPos = entry.find('=');
+        size_t atPos = entry.find('@');
+        if (equalPos == std::string::npos || atPos == std::string::npos || atPos > equalPos) {
+            return -1;
+        }
+
+        return getVlanID(entry.substr(atPos + 1, equalPos - atPos - 1));
+    }
+
+    std::string NetUtil::getSubnetListEntrySubnet(std::string entry) {
+        size_t equalPos = entry.find('=');
+        if (equalPos == std::string::npos) {
+            return entry;
+        }
+
+        return entry.substr(equalPos + 1);
+    }
+
+    bool NetUtil::getIsSubnetListIPv4Valid(std::string subnetList) {
+        std::vector<std::string> entries = getSubnetListEntries(subnetList);
+        if (entries.empty()) {
+            return false;
+        }
+
+        for (const std::string& entry : entries) {
+            if (getIsSubnetStringIPv4Valid(getSubnetListEntrySubnet(entry)) == false) {
+                return false;
+            }
+            if (entry.find('@') < entry.find('=') && getSubnetListEntryVlanID(entry) < 0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool NetUtil::getIsSubnetListIPv6Valid(std::string subnetList) {
+        std::vector<std::string> entries = getSubnetListEntries(subnetList);
+        if (entries.empty()) {
+            return false;
+        }
+
+        for (const std::string& entry : entries) {
+            if (getIsSubnetStringIPv6Valid(getSubnetListEntrySubnet(entry)) == false) {
+                return false;
+            }
+            if (entry.find('@') < entry.find('=') && getSubnetListEntryVlanID(entry) < 0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     int NetUtil::getSubnetPrefix(std::string subnetAddrWithPrefix) {
         // check '/' is found & is not last character
         int slashPos = subnetAddrWithPrefix.find('/');
@@ -181,6 +269,50 @@ namespace Netvisix {
         return "";
     }
 
+    std::string NetUtil::getVlanString(unsigned int vlanID) {
+        unsigned int outer = vlanID >> 12;
+        unsigned int inner = vlanID & 0xfff;
+        return (outer > 0) ? std::to_string(outer) + "." + std::to_string(inner) : std::to_string(inner);
+    }
+
+    int NetUtil::getVlanID(std::string vlanString) {
+        if (vlanString.empty() || vlanString.find_first_not_of("0123456789.") != std::string::npos) {
+            return -1;
+        }
+
+        size_t dotPos = vlanString.find('.');
+        std::string outerString = (dotPos != std::string::npos) ? vlanString.substr(0, dotPos) : "0";
+        std::string innerString = (dotPos != std::string::npos) ? vlanString.substr(dotPos + 1) : vlanString;
+        if (outerString.empty() || innerString.empty() || outerString.length() > 4 || innerString.length() > 4
+                || innerString.find('.') != std::string::npos) {
+            return -1;
+        }
+
+        int outer = std::strtol(outerString.c_str(), nullptr, 10);
+        int inner = std::strtol(innerString.c_str(), nullptr, 10);
+        if (outer > 4095 || inner > 4095) {
+            return -1;
+        }
+
+        return (outer << 12) | inner;
+    }
+
+    Tins::HWAddress<6> NetUtil::getEUI64AddrHW(Tins::IPv6Address ipv6Addr) {
+        const uint8_t* addr = ipv6Addr.begin();
+        if (addr[11] != 0xff || addr[12] != 0xfe) {
+            return zeroAddrHW;
+        }
+
+        uint8_t hwAddr[6] = { (uint8_t) (addr[8] ^ 0x02), addr[9], addr[10], addr[13], addr[14], addr[15] };
+        return Tins::HWAddress<6>(hwAddr);
+    }
+
+    Tins::IPv6Address NetUtil::getEUI64LinkLocalAddrIPv6(Tins::HWAddress<6> hwAddr) {
+        uint8_t addr[16] = { 0xfe, 0x80, 0, 0, 0, 0, 0, 0,
+                             (uint8_t) (hwAddr[0] ^ 0x02), hwAddr[1], hwAddr[2], 0xff, 0xfe, hwAddr[3], hwAddr[4], hwAddr[5] };
+        return Tins::IPv6Address(addr);
+    }
+
     std::string NetUtil::getByteString(unsigned long long byteCount) {
         std::string byteString = "";
 
@@ -215,4 +347,21 @@ namespace Netvisix {
         return byteString;
     }
 
+    unsigned int NetUtil::getTrailingZeroCount(uint64_t value) {
+#if defined(_MSC_VER) && defined(_WIN64)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return index;
+#elif defined(_MSC_VER)
+        unsigned long index;
+        if (_BitScanForward(&index, (unsigned long) value)) {
+            return index;
+        }
+        _BitScanForward(&index, (unsigned long) (value >> 32));
+        return index + 32;
+#else
+        return __builtin_ctzll(value);
+#endif
+    }
+
 } // namespace Netvisix
@@ -40,12 +40,32 @@ namespace Netvisix {
             static bool getIsSubnetStringIPv4Valid(std::string subnetAddrIPv4WithPrefix);
             static bool getIsSubnetStringIPv6Valid(std::string subnetAddrIPv6WithPrefix);
 
+            // comma separated subnet list, entries as "subnet" or "name=subnet", "name@vlan=subnet" for one vlan only
+            static std::vector<std::string> getSubnetListEntries(std::string subnetList);
+            static std::string getSubnetListEntryName(std::string entry);
+            static std::string getSubnetListEntrySubnet(std::string entry);
+            static int getSubnetListEntryVlanID(std::string entry);
+            static bool getIsSubnetListIPv4Valid(std::string subnetList);
+            static bool getIsSubnetListIPv6Valid(std::string subnetList);
+
             static bool CheckCurrentUserSniffingPrivilegs(std::string interfaceName, std::string* excecptionString);
 
             static std::string ResolveHostname(Tins::IPv4Address);
 
             static std::string getByteString(unsigned long long byteCount);
 
+            // "100" or "200.100" (QinQ outer.inner), -1 if invalid
+            static std::string getVlanString(unsigned int vlanID);
+            static int getVlanID(std::string vlanString);
+
+            // mac of a modified eui-64 interface id (xx:xx:xx:ff:fe:xx:xx:xx, u/l bit inverted), zero if none
+            static Tins::HWAddress<6> getEUI64AddrHW(Tins::IPv6Address ipv6Addr);
+            // fe80::/64 with the eui-64 interface id of the mac
+            static Tins::IPv6Address getEUI64LinkLocalAddrIPv6(Tins::HWAddress<6> hwAddr);
+
+            // index of the lowest set bit (value != 0)
+            static unsigned int getTrailingZeroCount(uint64_t value);
+
             static const Tins::HWAddress<6> zeroAddrHW;
             static const Tins::IPv4Address zeroAddrIPv4;
             static const Tins::IPv6Address zeroAddrIPv6;
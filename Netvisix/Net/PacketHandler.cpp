@@ -20,21 +20,42 @@
 #include "PacketHandler.h"
 #include "Net/NetEvent.h"
 #include "Net/NetEventManager.h"
+#include "Net/DNSParser.h"
+#include "Net/DHCPParser.h"
+#include "Net/GroupReportParser.h"
+#include "Net/NetUtil.h"
+#include "Net/ServiceTable.h"
 
 #include <tins.h>
+#include <tins/constants.h>
+#include <cstring>
+
+// (missing in older libpcap headers)
+#ifndef DLT_LINUX_SLL2
+#define DLT_LINUX_SLL2 276
+#endif
 
 
 namespace Netvisix {
 
+    int PacketHandler::linkType = DLT_EN10MB;
+    PayloadInspector* PacketHandler::payloadInspector = nullptr;
+    bool PacketHandler::payloadInspectionEnabled = false;
+    bool PacketHandler::isFrameTruncated = false;
 
     PacketHandler::PacketHandler(std::string interfaceName, bool promiscMode) {
         Tins::SnifferConfiguration config;
         config.set_promisc_mode(promiscMode);
         sniffer = new Tins::Sniffer(interfaceName, config);
+
+        delete payloadInspector;
+        payloadInspector = new PayloadInspector();
     }
 
     PacketHandler::~PacketHandler() {
         delete sniffer;
+        delete payloadInspector;
+        payloadInspector = nullptr;
     }
 
     void PacketHandler::destroy() {
@@ -44,7 +65,16 @@ namespace Netvisix {
     }
 
     void PacketHandler::run() {
-        sniffer->sniff_loop(callback);
+        linkType = sniffer->link_type();
+        payloadInspectionEnabled = (pcap_snapshot(sniffer->get_pcap_handle()) >= PAYLOAD_INSPECTION_SNAPLEN_MIN);
+        isFrameTruncated = false;
+        if (linkType == DLT_EN10MB) {
+            sniffer->sniff_loop(callback);
+        }
+        else {
+            // (libtins has no sll2 and drops cooked / raw frames in sniff_loop, so decode the link header ourselves)
+            pcap_loop(sniffer->get_pcap_handle(), -1, rawCallback, nullptr);
+        }
     }
 
     bool PacketHandler::callback(const Tins::PDU &pdu) {
@@ -56,10 +86,6 @@ namespace Netvisix {
         NetEvent* ne = new NetEvent();
 
         const Tins::EthernetII* pduETH = nullptr;
-        const Tins::IP* pduIPv4 = nullptr;
-        const Tins::IPv6* pduIPv6 = nullptr;
-        const Tins::UDP* pduUDP = nullptr;
-        const Tins::TCP* pduTCP = nullptr;
 
         ne->size = pdu.size();
         if ((pduETH = pdu.find_pdu<Tins::EthernetII>())) {
@@ -67,72 +93,477 @@ namespace Netvisix {
             ne->srcAddrHW = pduETH->src_addr();
             ne->dstAddrHW = pduETH->dst_addr();
 
-            // IPv4 or IPv6
-            pduIPv4 = nullptr;
-            pduIPv6 = nullptr;
-            if ((pduIPv4 = pduETH->find_pdu<Tins::IP>())) {
-                ne->l2Protocol = Protocol::IPv4;
-                ne->srcAddrIPv4 = pduIPv4->src_addr();
-                ne->dstAddrIPv4 = pduIPv4->dst_addr();
-            }
-            else if ((pduIPv6 = pduETH->find_pdu<Tins::IPv6>())) {
-                ne->l2Protocol = Protocol::IPv6;
-                ne->srcAddrIPv6 = pduIPv6->src_addr();
-                ne->dstAddrIPv6 = pduIPv6->dst_addr();
+            // 802.1Q / QinQ (802.1ad or 0x9100 outer tag)
+            const Tins::Dot1Q* pduDot1Q = nullptr;
+            uint16_t payloadType = pduETH->payload_type();
+            bool isTagged = (payloadType == Tins::Constants::Ethernet::VLAN || payloadType == Tins::Constants::Ethernet::QINQ
+                    || payloadType == Tins::Constants::Ethernet::OLD_QINQ);
+            if (isTagged && (pduDot1Q = pduETH->find_pdu<Tins::Dot1Q>())) {
+                const Tins::Dot1Q* pduInnerDot1Q = (pduDot1Q->inner_pdu() != nullptr) ? pduDot1Q->inner_pdu()->find_pdu<Tins::Dot1Q>() : nullptr;
+                if (pduInnerDot1Q != nullptr) {
+                    ne->vlanID = ((unsigned int) pduDot1Q->id() << 12) | pduInnerDot1Q->id();
+                }
+                else {
+                    ne->vlanID = pduDot1Q->id();
+                }
             }
 
-            if (pduIPv4 || pduIPv6) {
+            handleNetworkLayer(*pduETH, ne);
+        }
+        // (no ethernet II frame)
+        else {
+            ne->l1Protocol = Protocol::Unkown;
+        }
 
-                // TCP
-                if ((pduTCP = pduETH->find_pdu<Tins::TCP>())) {
-                    ne->l3Protocol = Protocol::TCP;
-                }
+        nm->handleNetEvent(ne);
+
+        return true;
+    }
+
+    void PacketHandler::rawCallback(unsigned char* user, const struct pcap_pkthdr* header, const unsigned char* data) {
+        (void) user;
 
-                // UDP
-                else if ((pduUDP = pduETH->find_pdu<Tins::UDP>())) {
-                    ne->l3Protocol = Protocol::UDP;
+        NetEventManager* nm = NetEventManager::SharedInstance();
+        if (nm->getIsPaused()) {
+            return;
+        }
+
+        NetEvent* ne = new NetEvent();
+        ne->size = header->len;
+        isFrameTruncated = (header->caplen < header->len);
 
-                    // DNS
-                    if (pduUDP->sport() == 53 || pduUDP->dport() == 53) {
-                        Tins::DNS pduDNS = pduUDP->rfind_pdu<Tins::RawPDU>().to<Tins::DNS>();
-                        if (pduDNS.answers_count() > 0) {
-                            std::string hostname = pduDNS.answers().front().dname();
-                            for (const auto &answer : pduDNS.answers()) {
-                                nm->handleDNSAnswer(answer.data(), hostname);
-                            }
-                        }
+        unsigned int size = header->caplen;
+        unsigned int offset = 0;
+        uint16_t etherType = 0; // (0: take the ip version from the first nibble)
+
+        switch (linkType) {
+            // linux cooked capture (e.g. the "any" interface)
+            case DLT_LINUX_SLL:
+                if (size >= 16) {
+                    ne->l1Protocol = Protocol::LinuxSLL;
+                    // (sender address, only for ethernet devices)
+                    if (((data[2] << 8) | data[3]) == 1 && ((data[4] << 8) | data[5]) == 6) {
+                        ne->srcAddrHW = Tins::HWAddress<6>(data + 6);
+                    }
+                    etherType = (data[14] << 8) | data[15];
+                    offset = 16;
+                }
+                break;
+            case DLT_LINUX_SLL2:
+                if (size >= 20) {
+                    ne->l1Protocol = Protocol::LinuxSLL;
+                    if (((data[8] << 8) | data[9]) == 1 && data[11] == 6) {
+                        ne->srcAddrHW = Tins::HWAddress<6>(data + 12);
                     }
+                    etherType = (data[0] << 8) | data[1];
+                    offset = 20;
+                }
+                break;
+
+            // bsd loopback (the address family values differ between systems, so use the ip version)
+            case DLT_NULL:
+            case DLT_LOOP:
+                if (size >= 4) {
+                    ne->l1Protocol = Protocol::Loopback;
+                    offset = 4;
+                }
+                break;
+
+            // raw ip (tun devices, some vpns)
+            case DLT_RAW:
+#ifdef DLT_IPV4
+            case DLT_IPV4:
+#endif
+#ifdef DLT_IPV6
+            case DLT_IPV6:
+#endif
+                ne->l1Protocol = Protocol::RawIP;
+                break;
+        }
+
+        if (ne->l1Protocol != Protocol::Unkown && offset < size) {
+            const uint8_t* payload = data + offset;
+            unsigned int payloadSize = size - offset;
+            uint8_t ipVersion = payload[0] >> 4;
+
+            try {
+                if (etherType == Tins::Constants::Ethernet::ARP) {
+                    Tins::ARP pduARP(payload, payloadSize);
+                    handleNetworkLayer(pduARP, ne);
                 }
-                // ICMP
-                else if (pduETH->find_pdu<Tins::ICMP>()) {
-                    ne->l3Protocol = Protocol::ICMP;
+                else if (etherType == Tins::Constants::Ethernet::IP || (etherType == 0 && ipVersion == 4)) {
+                    Tins::IP pduIPv4(payload, payloadSize);
+                    handleNetworkLayer(pduIPv4, ne);
                 }
-                // ICMPv6
-                else if (pduETH->find_pdu<Tins::ICMPv6>()) {
-                    ne->l3Protocol = Protocol::ICMPv6;
+                else if (etherType == Tins::Constants::Ethernet::IPV6 || (etherType == 0 && ipVersion == 6)) {
+                    Tins::IPv6 pduIPv6(payload, payloadSize);
+                    handleNetworkLayer(pduIPv6, ne);
                 }
                 else {
-                    ne->l3Protocol = Protocol::OtherL3;
+                    ne->l2Protocol = Protocol::OtherL2;
+                }
+            }
+            catch (Tins::malformed_packet&) {
+                ne->l2Protocol = Protocol::OtherL2;
+            }
+        }
+
+        nm->handleNetEvent(ne);
+    }
+
+    void PacketHandler::handleNetworkLayer(const Tins::PDU &pdu, NetEvent* ne) {
+        const Tins::IP* pduIPv4 = nullptr;
+        const Tins::IPv6* pduIPv6 = nullptr;
+        const Tins::UDP* pduUDP = nullptr;
+        const Tins::TCP* pduTCP = nullptr;
+        const Tins::ARP* pduARP = nullptr;
+        const Tins::ICMPv6* pduICMPv6 = nullptr;
+        const Tins::MPLS* pduMPLS = nullptr;
+
+        // MPLS (label stack decoded by libtins, the ip header below is the inner one)
+        if ((pduMPLS = pdu.find_pdu<Tins::MPLS>())) {
+            setTunnel(ne, Tunnel::MPLS, pduMPLS->label());
+        }
+
+        // IPv4 or IPv6 (the outermost one, ip-in-ip chains may hold both)
+        const Tins::PDU* pduIP = &pdu;
+        while (pduIP != nullptr && pduIP->pdu_type() != Tins::PDU::IP && pduIP->pdu_type() != Tins::PDU::IPv6) {
+            pduIP = pduIP->inner_pdu();
+        }
+        if (pduIP != nullptr && pduIP->pdu_type() == Tins::PDU::IP) {
+            pduIPv4 = static_cast<const Tins::IP*>(pduIP);
+            ne->l2Protocol = Protocol::IPv4;
+            ne->srcAddrIPv4 = pduIPv4->src_addr();
+            ne->dstAddrIPv4 = pduIPv4->dst_addr();
+        }
+        else if (pduIP != nullptr) {
+            pduIPv6 = static_cast<const Tins::IPv6*>(pduIP);
+            ne->l2Protocol = Protocol::IPv6;
+            ne->srcAddrIPv6 = pduIPv6->src_addr();
+            ne->dstAddrIPv6 = pduIPv6->dst_addr();
+        }
+
+        if (pduIPv4 || pduIPv6) {
+            TunnelParser::Inner inner;
+
+            // ip-in-ip, 4in6, 6in4 (decoded by libtins): account the inner header, keep the outer endpoints
+            const Tins::PDU* pduInnerIP = pduIP->inner_pdu();
+            if (pduInnerIP != nullptr && (pduInnerIP->pdu_type() == Tins::PDU::IP || pduInnerIP->pdu_type() == Tins::PDU::IPv6)) {
+                setTunnel(ne, Tunnel::IPinIP, 0);
+                handleNetworkLayer(*pduInnerIP, ne);
+                return;
+            }
+
+            // TCP
+            if ((pduTCP = pduIP->find_pdu<Tins::TCP>())) {
+                ne->l3Protocol = Protocol::TCP;
+                ne->service = ServiceTable::getService(false, pduTCP->sport(), pduTCP->dport());
+                ne->srcPort = pduTCP->sport();
+                ne->dstPort = pduTCP->dport();
+
+                // DNS over TCP (responses)
+                const Tins::RawPDU* pduRaw = pduTCP->find_pdu<Tins::RawPDU>();
+                if (pduTCP->sport() == 53 && pduRaw != nullptr) {
+                    DNSParser::parseTCPSegment(pduRaw->payload().data(), pduRaw->payload().size(), onDNSAnswer, ne);
+                }
+
+                bool isSYN = (pduTCP->flags() & (Tins::TCP::SYN | Tins::TCP::ACK)) == Tins::TCP::SYN;
+                ne->isTCPSYN = isSYN;
+                if ((pduTCP->flags() & (Tins::TCP::SYN | Tins::TCP::ACK)) == (Tins::TCP::SYN | Tins::TCP::ACK)) {
+                    ne->openPortTCP = pduTCP->sport();
+                }
+                if (pduRaw != nullptr) {
+                    inspectTCPPayload(ne, pduTCP->sport(), pduTCP->dport(), isSYN, pduRaw->payload().data(), pduRaw->payload().size());
+                }
+                else if (isSYN) {
+                    inspectTCPPayload(ne, pduTCP->sport(), pduTCP->dport(), isSYN, nullptr, 0);
                 }
             }
 
-            // ARP
-            else if (pdu.find_pdu<Tins::ARP>()) {
-                ne->l2Protocol = Protocol::ARP;
+            // UDP
+            else if ((pduUDP = pduIP->find_pdu<Tins::UDP>())) {
+                ne->l3Protocol = Protocol::UDP;
+                ne->service = ServiceTable::getService(true, pduUDP->sport(), pduUDP->dport());
+                ne->srcPort = pduUDP->sport();
+                ne->dstPort = pduUDP->dport();
+                setOpenPortUDP(ne, pduUDP->sport(), pduUDP->dport());
+
+                const Tins::RawPDU* pduRaw = pduUDP->find_pdu<Tins::RawPDU>();
+                if (pduRaw != nullptr) {
+                    const uint8_t* payload = pduRaw->payload().data();
+                    size_t payloadSize = pduRaw->payload().size();
+
+                    // VXLAN, GENEVE
+                    if (TunnelParser::parseUDP(pduUDP->dport(), payload, payloadSize, inner)) {
+                        handleTunnelPayload(inner, ne);
+                        return;
+                    }
+
+                    handleUDPPayload(ne, pduUDP->sport(), pduUDP->dport(), payload, payloadSize);
+                }
+            }
+            // ICMP
+            else if (pduIP->find_pdu<Tins::ICMP>()) {
+                ne->l3Protocol = Protocol::ICMP;
+            }
+            // ICMPv6
+            else if ((pduICMPv6 = pduIP->find_pdu<Tins::ICMPv6>())) {
+                ne->l3Protocol = Protocol::ICMPv6;
+                if (pduIPv6 != nullptr) {
+                    handleNDP(*pduIPv6, *pduICMPv6, ne);
+                }
+
+                // MLD reports (v1 group address is not kept by libtins, reports are rare enough to serialize)
+                if (pduICMPv6->type() == Tins::ICMPv6::MLD2_REPORT) {
+                    for (const Tins::ICMPv6::multicast_address_record& record : pduICMPv6->multicast_address_records()) {
+                        GroupReportParser::addGroupRecord(record.type, record.sources.size(), record.multicast_address.begin(), 16, ne->groupReports);
+                    }
+                }
+                else if (GroupReportParser::getIsMLDReport(pduICMPv6->type())) {
+                    Tins::ICMPv6 pduCopy(*pduICMPv6);
+                    Tins::PDU::serialization_type data = pduCopy.serialize();
+                    GroupReportParser::parseMLD(data.data(), data.size(), ne->groupReports);
+                }
             }
-            // ?
             else {
-                ne->l2Protocol = Protocol::OtherL2;
+                ne->l3Protocol = Protocol::OtherL3;
+
+                // GRE / ERSPAN (and ip-in-ip libtins left undecoded)
+                const Tins::RawPDU* pduRaw = pduIP->find_pdu<Tins::RawPDU>();
+                uint8_t ipProtocol = (pduIPv4 != nullptr) ? pduIPv4->protocol() : pduIPv6->next_header();
+
+                // IGMP
+                if (pduRaw != nullptr && ipProtocol == GroupReportParser::PROTOCOL_IGMP) {
+                    GroupReportParser::parseIGMP(pduRaw->payload().data(), pduRaw->payload().size(), ne->groupReports);
+                    return;
+                }
+
+                if (pduRaw != nullptr
+                        && TunnelParser::parseIP(ipProtocol, pduRaw->payload().data(), pduRaw->payload().size(), inner)) {
+                    handleTunnelPayload(inner, ne);
+                    return;
+                }
             }
         }
-        // (no ethernet II frame)
+
+        // ARP
+        else if ((pduARP = pdu.find_pdu<Tins::ARP>())) {
+            ne->l2Protocol = Protocol::ARP;
+            // (no ethernet header, take the sender from the arp payload)
+            if (ne->l1Protocol != Protocol::EthernetII) {
+                ne->srcAddrHW = pduARP->sender_hw_addr();
+            }
+
+            // (probes carry sender ip 0.0.0.0)
+            if (pduARP->sender_ip_addr() != NetUtil::zeroAddrIPv4) {
+                ne->bindingAddrHW = pduARP->sender_hw_addr();
+                ne->bindingAddrIPv4 = pduARP->sender_ip_addr();
+            }
+        }
+        // ?
         else {
-            ne->l1Protocol = Protocol::Unkown;
+            ne->l2Protocol = Protocol::OtherL2;
         }
+    }
 
-        nm->handleNetEvent(ne);
+    void PacketHandler::handleNDP(const Tins::IPv6 &pduIPv6, const Tins::ICMPv6 &pduICMPv6, NetEvent* ne) {
+        // (ndp is link-local only: hop limit 255, never through a tunnel)
+        if (pduIPv6.hop_limit() != 255 || ne->tunnel != Tunnel::None) {
+            return;
+        }
 
-        return true;
+        const Tins::ICMPv6::option* opt = nullptr;
+        Tins::IPv6Address addrIPv6 = NetUtil::zeroAddrIPv6;
+        switch (pduICMPv6.type()) {
+            case Tins::ICMPv6::ROUTER_SOLICIT:
+            case Tins::ICMPv6::ROUTER_ADVERT:
+            case Tins::ICMPv6::NEIGHBOUR_SOLICIT:
+                // (dad probes come from ::, without source option)
+                opt = pduICMPv6.search_option(Tins::ICMPv6::SOURCE_ADDRESS);
+                addrIPv6 = pduIPv6.src_addr();
+                break;
+            case Tins::ICMPv6::NEIGHBOUR_ADVERT:
+                opt = pduICMPv6.search_option(Tins::ICMPv6::TARGET_ADDRESS);
+                addrIPv6 = pduICMPv6.target_addr();
+                break;
+            default:
+                break;
+        }
+
+        if (opt != nullptr && opt->data_size() >= 6 && addrIPv6 != NetUtil::zeroAddrIPv6) {
+            ne->bindingAddrHW = Tins::HWAddress<6>(opt->data_ptr());
+            ne->bindingAddrIPv6 = addrIPv6;
+        }
+    }
+
+    void PacketHandler::handleTunnelPayload(const TunnelParser::Inner &inner, NetEvent* ne) {
+        setTunnel(ne, inner.tunnel, inner.tunnelID);
+
+        if (inner.srcAddrHW != nullptr) {
+            ne->srcAddrHW = Tins::HWAddress<6>(inner.srcAddrHW);
+            ne->dstAddrHW = Tins::HWAddress<6>(inner.dstAddrHW);
+        }
+
+        ne->l3Protocol = Protocol::Unkown;
+        ne->service = Service::None;
+        ne->openPortUDP = 0;
+        ne->srcPort = 0;
+        ne->dstPort = 0;
+        if (inner.etherType == TunnelParser::ETHER_TYPE_ARP) {
+            ne->l2Protocol = Protocol::ARP;
+            return;
+        }
+        else if (inner.etherType == TunnelParser::ETHER_TYPE_IPV4) {
+            uint32_t addrRaw;
+            ne->l2Protocol = Protocol::IPv4;
+            std::memcpy(&addrRaw, inner.srcAddr, 4);
+            ne->srcAddrIPv4 = Tins::IPv4Address(addrRaw);
+            std::memcpy(&addrRaw, inner.dstAddr, 4);
+            ne->dstAddrIPv4 = Tins::IPv4Address(addrRaw);
+        }
+        else {
+            ne->l2Protocol = Protocol::IPv6;
+            ne->srcAddrIPv6 = Tins::IPv6Address(inner.srcAddr);
+            ne->dstAddrIPv6 = Tins::IPv6Address(inner.dstAddr);
+        }
+
+        // (transport header in place, same payload parsers as for untunneled frames)
+        const uint8_t* data = inner.payload;
+        size_t size = inner.payloadSize;
+        if (inner.protocol == TunnelParser::PROTOCOL_TCP) {
+            ne->l3Protocol = Protocol::TCP;
+            if (size >= 4) {
+                ne->service = ServiceTable::getService(false, TunnelParser::read16(data), TunnelParser::read16(data + 2));
+                ne->srcPort = TunnelParser::read16(data);
+                ne->dstPort = TunnelParser::read16(data + 2);
+            }
+            size_t headerSize = (size >= 20) ? (data[12] >> 4) * 4 : 0;
+            if (headerSize >= 20 && headerSize <= size) {
+                uint16_t sport = TunnelParser::read16(data);
+                if (sport == 53) {
+                    DNSParser::parseTCPSegment(data + headerSize, size - headerSize, onDNSAnswer, ne);
+                }
+
+                // (flags: syn 0x02, ack 0x10)
+                bool isSYN = (data[13] & 0x12) == 0x02;
+                ne->isTCPSYN = isSYN;
+                if ((data[13] & 0x12) == 0x12) {
+                    ne->openPortTCP = sport;
+                }
+                inspectTCPPayload(ne, sport, TunnelParser::read16(data + 2), isSYN, data + headerSize, size - headerSize);
+            }
+        }
+        else if (inner.protocol == TunnelParser::PROTOCOL_UDP) {
+            ne->l3Protocol = Protocol::UDP;
+            if (size >= 8) {
+                ne->service = ServiceTable::getService(true, TunnelParser::read16(data), TunnelParser::read16(data + 2));
+                ne->srcPort = TunnelParser::read16(data);
+                ne->dstPort = TunnelParser::read16(data + 2);
+                setOpenPortUDP(ne, TunnelParser::read16(data), TunnelParser::read16(data + 2));
+                handleUDPPayload(ne, TunnelParser::read16(data), TunnelParser::read16(data + 2), data + 8, size - 8);
+            }
+        }
+        else if (inner.protocol == 1) {
+            ne->l3Protocol = Protocol::ICMP;
+        }
+        else if (inner.protocol == 58) {
+            ne->l3Protocol = Protocol::ICMPv6;
+            if (size > 0 && GroupReportParser::getIsMLDReport(data[0])) {
+                GroupReportParser::parseMLD(data, size, ne->groupReports);
+            }
+        }
+        else if (inner.protocol == GroupReportParser::PROTOCOL_IGMP) {
+            ne->l3Protocol = Protocol::OtherL3;
+            GroupReportParser::parseIGMP(data, size, ne->groupReports);
+        }
+        else {
+            ne->l3Protocol = Protocol::OtherL3;
+        }
+    }
+
+    void PacketHandler::handleUDPPayload(NetEvent* ne, uint16_t sport, uint16_t dport, const uint8_t* payload, size_t payloadSize) {
+        // DNS, mDNS, LLMNR
+        if (sport == 53 || dport == 53 || sport == 5353 || sport == 5355) {
+            DNSParser::parseMessage(payload, payloadSize, onDNSAnswer, ne);
+        }
+        // NetBIOS name service
+        else if (sport == 137 || dport == 137) {
+            DNSParser::parseNBNSMessage(payload, payloadSize, onDNSAnswer, onNameRelease, ne);
+        }
+        // DHCP
+        else if ((sport == 67 || sport == 68) && (dport == 67 || dport == 68)) {
+            DHCPParser::parseMessage(payload, payloadSize, onDNSAnswer, ne);
+
+            uint8_t hwAddr[6];
+            uint32_t addrRaw;
+            if (ne->tunnel == Tunnel::None && DHCPParser::getClientBinding(payload, payloadSize, hwAddr, (uint8_t*) &addrRaw)) {
+                ne->bindingAddrHW = Tins::HWAddress<6>(hwAddr);
+                ne->bindingAddrIPv4 = Tins::IPv4Address(addrRaw);
+            }
+        }
+    }
+
+    void PacketHandler::setOpenPortUDP(NetEvent* ne, uint16_t sport, uint16_t dport) {
+        // (no connection state for udp, a server port answering an ephemeral client port)
+        if (sport != 0 && sport < ServiceTable::EPHEMERAL_PORT_MIN && dport >= ServiceTable::EPHEMERAL_PORT_MIN) {
+            ne->openPortUDP = sport;
+        }
+    }
+
+    void PacketHandler::inspectTCPPayload(NetEvent* ne, uint16_t sport, uint16_t dport, bool isSYN, const uint8_t* payload, size_t payloadSize) {
+        if (payloadInspectionEnabled == false || isFrameTruncated || (isSYN == false && payloadSize == 0)) {
+            return;
+        }
+
+        uint32_t flowHash;
+        if (ne->isIPv4()) {
+            uint32_t srcAddrRaw = ne->srcAddrIPv4;
+            uint32_t dstAddrRaw = ne->dstAddrIPv4;
+            flowHash = PayloadInspector::getFlowHash((const uint8_t*) &srcAddrRaw, (const uint8_t*) &dstAddrRaw, 4, sport, dport);
+        }
+        else {
+            flowHash = PayloadInspector::getFlowHash(ne->srcAddrIPv6.begin(), ne->dstAddrIPv6.begin(), 16, sport, dport);
+        }
+
+        if (isSYN) {
+            payloadInspector->startFlow(flowHash);
+            return;
+        }
+
+        char name[256];
+        if (payloadInspector->inspect(flowHash, payload, payloadSize, name, sizeof(name))) {
+            ne->serverName = name;
+        }
+    }
+
+    void PacketHandler::setTunnel(NetEvent* ne, Tunnel tunnel, uint32_t tunnelID) {
+        // (outermost tunnel only, its endpoints are the addresses parsed so far)
+        if (ne->tunnel == Tunnel::None) {
+            ne->tunnel = tunnel;
+            ne->tunnelID = tunnelID;
+            ne->tunnelSrcAddrIPv4 = ne->srcAddrIPv4;
+            ne->tunnelDstAddrIPv4 = ne->dstAddrIPv4;
+            ne->tunnelSrcAddrIPv6 = ne->srcAddrIPv6;
+            ne->tunnelDstAddrIPv6 = ne->dstAddrIPv6;
+        }
+
+        // (outer addresses must not match the inner hosts)
+        ne->srcAddrHW = NetUtil::zeroAddrHW;
+        ne->dstAddrHW = NetUtil::zeroAddrHW;
+        ne->srcAddrIPv4 = NetUtil::zeroAddrIPv4;
+        ne->dstAddrIPv4 = NetUtil::zeroAddrIPv4;
+        ne->srcAddrIPv6 = NetUtil::zeroAddrIPv6;
+        ne->dstAddrIPv6 = NetUtil::zeroAddrIPv6;
+    }
+
+    void PacketHandler::onDNSAnswer(void* context, const uint8_t* addr, unsigned int addrLength, const char* name, uint32_t ttl) {
+        NetEvent* ne = static_cast<NetEvent*>(context);
+        NetEventManager::SharedInstance()->handleDNSAnswer(addr, addrLength, name, ttl, ne->vlanID);
+    }
+
+    void PacketHandler::onNameRelease(void* context, const uint8_t* addr, unsigned int addrLength, const char* name) {
+        NetEvent* ne = static_cast<NetEvent*>(context);
+        NetEventManager::SharedInstance()->handleNameRelease(addr, addrLength, name, ne->vlanID);
     }
 
 } // namespace Netvisix
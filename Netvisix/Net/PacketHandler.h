@@ -20,6 +20,9 @@
 #ifndef PACKETHANDLER_H
 #define PACKETHANDLER_H
 
+#include "Net/TunnelParser.h"
+#include "Net/PayloadInspector.h"
+
 #include <QThread>
 
 #include <tins.h>
@@ -39,6 +42,26 @@ namespace Netvisix {
             void run();
 
             static bool callback(const Tins::PDU &pdu);
+            static void rawCallback(unsigned char* user, const struct pcap_pkthdr* header, const unsigned char* data);
+            static void handleNetworkLayer(const Tins::PDU &pdu, NetEvent* ne);
+            static void handleNDP(const Tins::IPv6 &pduIPv6, const Tins::ICMPv6 &pduICMPv6, NetEvent* ne);
+            static void handleTunnelPayload(const TunnelParser::Inner &inner, NetEvent* ne);
+            static void handleUDPPayload(NetEvent* ne, uint16_t sport, uint16_t dport, const uint8_t* payload, size_t payloadSize);
+            static void setTunnel(NetEvent* ne, Tunnel tunnel, uint32_t tunnelID);
+            static void setOpenPortUDP(NetEvent* ne, uint16_t sport, uint16_t dport);
+            static void inspectTCPPayload(NetEvent* ne, uint16_t sport, uint16_t dport, bool isSYN, const uint8_t* payload, size_t payloadSize);
+            // (context: the NetEvent of the packet being parsed)
+            static void onDNSAnswer(void* context, const uint8_t* addr, unsigned int addrLength, const char* name, uint32_t ttl);
+            static void onNameRelease(void* context, const uint8_t* addr, unsigned int addrLength, const char* name);
+
+            // (datalink type of the capture, for rawCallback)
+            static int linkType;
+
+            // tls sni / http host of the first client segments (off if the snap length truncates payloads)
+            static PayloadInspector* payloadInspector;
+            static bool payloadInspectionEnabled;
+            static bool isFrameTruncated;
+            static const int PAYLOAD_INSPECTION_SNAPLEN_MIN = 1514;
 
             Tins::Sniffer* sniffer;
     };
@@ -0,0 +1,223 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PayloadInspector.h"
+
+#include <cstring>
+
+
+namespace Netvisix {
+
+    PayloadInspector::PayloadInspector() {
+        flows = new Flow[FLOWS_SIZE];
+        clear();
+    }
+
+    PayloadInspector::~PayloadInspector() {
+        delete[] flows;
+    }
+
+    uint32_t PayloadInspector::getFlowHash(const uint8_t* srcAddr, const uint8_t* dstAddr, unsigned int addrLength, uint16_t sport, uint16_t dport) {
+        // (fnv-1a, 0 marks a free slot)
+        uint32_t hash = 2166136261u;
+        for (unsigned int i = 0; i < addrLength; i++) {
+            hash = (hash ^ srcAddr[i]) * 16777619u;
+            hash = (hash ^ dstAddr[i]) * 16777619u;
+        }
+        hash = (hash ^ (sport >> 8)) * 16777619u;
+        hash = (hash ^ (sport & 0xff)) * 16777619u;
+        hash = (hash ^ (dport >> 8)) * 16777619u;
+        hash = (hash ^ (dport & 0xff)) * 16777619u;
+
+        return (hash != 0) ? hash : 1;
+    }
+
+    void PayloadInspector::startFlow(uint32_t flowHash) {
+        // (collisions replace the older flow)
+        Flow& flow = flows[flowHash & (FLOWS_SIZE - 1)];
+        flow.tag = flowHash;
+        flow.segments = 0;
+    }
+
+    bool PayloadInspector::inspect(uint32_t flowHash, const uint8_t* data, size_t size, char* name, size_t nameSize) {
+        Flow& flow = flows[flowHash & (FLOWS_SIZE - 1)];
+        if (flow.tag != flowHash || flow.segments >= SEGMENTS_MAX || size == 0) {
+            return false;
+        }
+        flow.segments++;
+
+        bool isFound = (data[0] == TLS_CONTENT_HANDSHAKE) ? parseTLSClientHello(data, size, name, nameSize)
+                                                          : parseHTTPHost(data, size, name, nameSize);
+        if (isFound) {
+            flow.segments = SEGMENTS_MAX;
+        }
+        return isFound;
+    }
+
+    void PayloadInspector::clear() {
+        for (unsigned int i = 0; i < FLOWS_SIZE; i++) {
+            flows[i].tag = 0;
+            flows[i].segments = SEGMENTS_MAX;
+        }
+    }
+
+    size_t PayloadInspector::getMemoryUsage() {
+        return sizeof(PayloadInspector) + FLOWS_SIZE * sizeof(Flow);
+    }
+
+    bool PayloadInspector::parseTLSClientHello(const uint8_t* data, size_t size, char* name, size_t nameSize) {
+        // record header, handshake header, version, random
+        if (size < 43 || data[0] != TLS_CONTENT_HANDSHAKE || data[1] != 3 || data[5] != TLS_CLIENT_HELLO) {
+            return false;
+        }
+        size_t offset = 43;
+
+        // session id, cipher suites, compression methods
+        if (offset + 1 > size) {
+            return false;
+        }
+        offset += 1 + data[offset];
+        if (offset + 2 > size) {
+            return false;
+        }
+        offset += 2 + read16(data + offset);
+        if (offset + 1 > size) {
+            return false;
+        }
+        offset += 1 + data[offset];
+
+        // extensions (only the part within this segment)
+        if (offset + 2 > size) {
+            return false;
+        }
+        size_t extensionsEnd = offset + 2 + read16(data + offset);
+        if (extensionsEnd > size) {
+            extensionsEnd = size;
+        }
+        offset += 2;
+
+        while (offset + 4 <= extensionsEnd) {
+            uint16_t type = read16(data + offset);
+            size_t length = read16(data + offset + 2);
+            offset += 4;
+            if (offset + length > extensionsEnd) {
+                return false;
+            }
+
+            // server name list: list length, name type (0: host name), name length, name
+            if (type == TLS_EXTENSION_SERVER_NAME) {
+                if (length < 5 || data[offset + 2] != 0) {
+                    return false;
+                }
+                size_t nameLength = read16(data + offset + 3);
+                if (5 + nameLength > length) {
+                    return false;
+                }
+                return copyName(data + offset + 5, nameLength, name, nameSize);
+            }
+
+            offset += length;
+        }
+
+        return false;
+    }
+
+    bool PayloadInspector::parseHTTPHost(const uint8_t* data, size_t size, char* name, size_t nameSize) {
+        // request line: method token, then " HTTP/1." before the first line break
+        static const char* const methods[] = { "GET ", "POST ", "HEAD ", "PUT ", "DELETE ", "OPTIONS ", "PATCH ", "CONNECT " };
+        bool isRequest = false;
+        for (const char* method : methods) {
+            size_t methodLength = std::strlen(method);
+            if (size >= methodLength && std::memcmp(data, method, methodLength) == 0) {
+                isRequest = true;
+                break;
+            }
+        }
+        if (isRequest == false) {
+            return false;
+        }
+
+        const uint8_t* lineEnd = (const uint8_t*) std::memchr(data, '\n', size);
+        if (lineEnd == nullptr || lineEnd - data < 14) {
+            return false;
+        }
+        const uint8_t* versionEnd = (lineEnd[-1] == '\r') ? lineEnd - 1 : lineEnd;
+        if (std::memcmp(versionEnd - 9, " HTTP/1.", 8) != 0) {
+            return false;
+        }
+
+        // header lines (case insensitive field name)
+        size_t offset = (lineEnd - data) + 1;
+        while (offset < size && data[offset] != '\r' && data[offset] != '\n') {
+            const uint8_t* next = (const uint8_t*) std::memchr(data + offset, '\n', size - offset);
+            size_t lineLength = (next != nullptr) ? (next - (data + offset)) : (size - offset);
+
+            if (lineLength > 5 && (data[offset] | 0x20) == 'h' && (data[offset + 1] | 0x20) == 'o'
+                    && (data[offset + 2] | 0x20) == 's' && (data[offset + 3] | 0x20) == 't' && data[offset + 4] == ':') {
+
+                // value without blanks, port and line break
+                size_t start = offset + 5;
+                size_t end = offset + lineLength;
+                while (start < end && (data[start] == ' ' || data[start] == '\t')) {
+                    start++;
+                }
+                size_t nameEnd = start;
+                while (nameEnd < end && data[nameEnd] != ':' && data[nameEnd] != '\r' && data[nameEnd] != ' ') {
+                    nameEnd++;
+                }
+                return copyName(data + start, nameEnd - start, name, nameSize);
+            }
+
+            if (next == nullptr) {
+                break;
+            }
+            offset += lineLength + 1;
+        }
+
+        return false;
+    }
+
+    bool PayloadInspector::copyName(const uint8_t* data, size_t length, char* name, size_t nameSize) {
+        // (trailing dot of absolute names)
+        if (length > 0 && data[length - 1] == '.') {
+            length--;
+        }
+        if (length == 0 || length >= nameSize) {
+            return false;
+        }
+
+        bool hasLetter = false;
+        for (size_t i = 0; i < length; i++) {
+            char c = (char) data[i];
+            bool isLetter = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+            if (isLetter == false && (c < '0' || c > '9') && c != '-' && c != '.' && c != '_') {
+                return false;
+            }
+            hasLetter = hasLetter || isLetter;
+        }
+        if (hasLetter == false) {
+            return false;
+        }
+
+        std::memcpy(name, data, length);
+        name[length] = '\0';
+        return true;
+    }
+
+} // namespace Netvisix
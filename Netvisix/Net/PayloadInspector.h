@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PAYLOADINSPECTOR_H
+#define PAYLOADINSPECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // server name of tcp flows: tls client hello sni or http/1.x host header, parsed in place
+    // in the first SEGMENTS_MAX client data segments of flows whose syn was seen
+    // (per flow state: a tag and a segment counter in a fixed direct mapped table)
+    class PayloadInspector {
+
+        public:
+            PayloadInspector();
+            virtual ~PayloadInspector();
+
+            // (client to server direction, src / dst addresses of 4 or 16 bytes)
+            static uint32_t getFlowHash(const uint8_t* srcAddr, const uint8_t* dstAddr, unsigned int addrLength, uint16_t sport, uint16_t dport);
+
+            // syn without ack
+            void startFlow(uint32_t flowHash);
+
+            // client data segment, true if a name was found (the flow is done then)
+            bool inspect(uint32_t flowHash, const uint8_t* data, size_t size, char* name, size_t nameSize);
+
+            void clear();
+
+            size_t getMemoryUsage();
+
+            static bool parseTLSClientHello(const uint8_t* data, size_t size, char* name, size_t nameSize);
+            static bool parseHTTPHost(const uint8_t* data, size_t size, char* name, size_t nameSize);
+
+        private:
+            struct Flow {
+                uint32_t tag;
+                uint8_t segments;
+            };
+
+            // (letters, digits, '-', '.', '_' and not an address literal)
+            static bool copyName(const uint8_t* data, size_t length, char* name, size_t nameSize);
+
+            static uint16_t read16(const uint8_t* data) { return (data[0] << 8) | data[1]; }
+
+            Flow* flows;
+
+            static const unsigned int FLOWS_SIZE = 8192;
+            static const uint8_t SEGMENTS_MAX = 3;
+            static const uint8_t TLS_CONTENT_HANDSHAKE = 22;
+            static const uint8_t TLS_CLIENT_HELLO = 1;
+            static const uint16_t TLS_EXTENSION_SERVER_NAME = 0;
+    };
+
+} // namespace Netvisix
+#endif // PAYLOADINSPECTOR_H
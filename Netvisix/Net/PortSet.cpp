@@ -0,0 +1,142 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PortSet.h"
+
+#include <algorithm>
+
+
+namespace Netvisix {
+
+    PortSet::PortSet() {
+        storage = nullptr;
+        count = 0;
+        capacity = 0;
+    }
+
+    PortSet::PortSet(const PortSet& other) {
+        storage = (other.capacity > 0) ? new uint16_t[other.capacity] : nullptr;
+        count = other.count;
+        capacity = other.capacity;
+        std::copy(other.storage, other.storage + other.capacity, storage);
+    }
+
+    PortSet::~PortSet() {
+        delete[] storage;
+    }
+
+    PortSet& PortSet::operator=(const PortSet& other) {
+        if (this != &other) {
+            PortSet copy(other);
+            std::swap(storage, copy.storage);
+            std::swap(count, copy.count);
+            std::swap(capacity, copy.capacity);
+        }
+        return *this;
+    }
+
+    bool PortSet::add(uint16_t port) {
+        uint16_t bit = uint16_t(1) << (port & 15);
+        if (getIsBitmap()) {
+            if (storage[port >> 4] & bit) {
+                return false;
+            }
+            storage[port >> 4] |= bit;
+            count++;
+            return true;
+        }
+
+        uint16_t* end = storage + count;
+        uint16_t* it = std::lower_bound(storage, end, port);
+        if (it != end && *it == port) {
+            return false;
+        }
+
+        if (count == ARRAY_MAX) {
+            // (count > ARRAY_MAX from here on)
+            convertToBitmap();
+            storage[port >> 4] |= bit;
+            count++;
+            return true;
+        }
+
+        if (count == capacity) {
+            size_t index = it - storage;
+            grow();
+            it = storage + index;
+            end = storage + count;
+        }
+        std::copy_backward(it, end, end + 1);
+        *it = port;
+        count++;
+        return true;
+    }
+
+    void PortSet::add(const PortSet& other) {
+        for (uint16_t port : other.getPorts()) {
+            add(port);
+        }
+    }
+
+    bool PortSet::contains(uint16_t port) const {
+        if (getIsBitmap()) {
+            return (storage[port >> 4] & (uint16_t(1) << (port & 15))) != 0;
+        }
+        return std::binary_search(storage, storage + count, port);
+    }
+
+    std::vector<uint16_t> PortSet::getPorts() const {
+        if (getIsBitmap() == false) {
+            return std::vector<uint16_t>(storage, storage + count);
+        }
+
+        std::vector<uint16_t> ports;
+        ports.reserve(count);
+        for (unsigned int word = 0; word < BITMAP_WORDS; word++) {
+            unsigned int bits = storage[word];
+            for (unsigned int bit = 0; bits != 0; bit++, bits >>= 1) {
+                if (bits & 1) {
+                    ports.push_back(word * 16 + bit);
+                }
+            }
+        }
+        return ports;
+    }
+
+    void PortSet::grow() {
+        unsigned int nCapacity = std::min(std::max(capacity * 2, ARRAY_CAPACITY_MIN), ARRAY_MAX);
+        uint16_t* nStorage = new uint16_t[nCapacity];
+        std::copy(storage, storage + count, nStorage);
+        delete[] storage;
+        storage = nStorage;
+        capacity = nCapacity;
+    }
+
+    void PortSet::convertToBitmap() {
+        // (ARRAY_MAX == BITMAP_WORDS, the full array is replaced by a bitmap of the same size)
+        uint16_t* bitmap = new uint16_t[BITMAP_WORDS]();
+        for (unsigned int i = 0; i < count; i++) {
+            bitmap[storage[i] >> 4] |= uint16_t(1) << (storage[i] & 15);
+        }
+        delete[] storage;
+        storage = bitmap;
+        capacity = BITMAP_WORDS;
+    }
+
+} // namespace Netvisix
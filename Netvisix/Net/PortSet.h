@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORTSET_H
+#define PORTSET_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // compressed set of 16 bit ports (one roaring container): a sorted array while sparse, a 64k bit
+    // bitmap once the array would outgrow it (ARRAY_MAX ports, 8 KiB either way)
+    // (per host value: 16 bytes while empty, the storage is allocated with the first port)
+    class PortSet {
+
+        public:
+            PortSet();
+            PortSet(const PortSet& other);
+            ~PortSet();
+
+            PortSet& operator=(const PortSet& other);
+
+            // (true if the port was not in the set)
+            bool add(uint16_t port);
+            void add(const PortSet& other);
+            bool contains(uint16_t port) const;
+
+            unsigned int getCount() const { return this->count; }
+            bool getIsEmpty() const { return this->count == 0; }
+
+            // (ascending)
+            std::vector<uint16_t> getPorts() const;
+
+            size_t getMemoryUsage() const { return this->capacity * sizeof(uint16_t); }
+
+        private:
+            // (ports are never removed, so the array only turns into the bitmap)
+            bool getIsBitmap() const { return this->count > ARRAY_MAX; }
+
+            void grow();
+            void convertToBitmap();
+
+            // sorted ports (capacity) or BITMAP_WORDS bitmap words, nullptr while empty
+            uint16_t* storage;
+            unsigned int count;
+            unsigned int capacity;
+
+            static const unsigned int ARRAY_MAX = 4096;
+            static const unsigned int ARRAY_CAPACITY_MIN = 4;
+            static const unsigned int BITMAP_WORDS = 65536 / 16;
+    };
+
+} // namespace Netvisix
+#endif // PORTSET_H
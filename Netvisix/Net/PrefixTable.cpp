@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PrefixTable.h"
+
+
+namespace Netvisix {
+
+    PrefixTable::PrefixTable(unsigned int addrBytes) {
+        this->addrBytes = addrBytes;
+        clear();
+    }
+
+    PrefixTable::~PrefixTable() {
+    }
+
+    void PrefixTable::clear() {
+        entries.clear();
+        defaultValue = -1;
+        addNode();
+    }
+
+    int PrefixTable::addNode() {
+        Entry empty;
+        empty.child = -1;
+        empty.value = -1;
+        empty.prefixLength = 0;
+
+        int node = entries.size() / STRIDE;
+        entries.resize(entries.size() + STRIDE, empty);
+        return node;
+    }
+
+    void PrefixTable::insert(const uint8_t* addr, unsigned int prefixLength, int value) {
+        if (prefixLength > addrBytes * 8) {
+            return;
+        }
+
+        if (prefixLength == 0) {
+            defaultValue = value;
+            return;
+        }
+
+        // walk the full bytes in front of the last (partial) byte
+        unsigned int depth = (prefixLength - 1) / 8;
+        int node = 0;
+        for (unsigned int i = 0; i < depth; i++) {
+            int child = entries[node * STRIDE + addr[i]].child;
+            if (child < 0) {
+                child = addNode();
+                entries[node * STRIDE + addr[i]].child = child;
+            }
+            node = child;
+        }
+
+        // expand the remaining bits over the covered entries of the last node
+        unsigned int bits = prefixLength - depth * 8;
+        unsigned int first = addr[depth] & (0xff << (8 - bits)) & 0xff;
+        unsigned int count = 1 << (8 - bits);
+        for (unsigned int i = first; i < first + count; i++) {
+            Entry& entry = entries[node * STRIDE + i];
+            // (a longer prefix that was inserted before keeps its entries)
+            if (entry.value < 0 || entry.prefixLength <= prefixLength) {
+                entry.value = value;
+                entry.prefixLength = prefixLength;
+            }
+        }
+    }
+
+    int PrefixTable::lookup(const uint8_t* addr) const {
+        int result = defaultValue;
+
+        int node = 0;
+        for (unsigned int i = 0; i < addrBytes; i++) {
+            const Entry& entry = entries[node * STRIDE + addr[i]];
+            if (entry.value >= 0) {
+                result = entry.value;
+            }
+            if (entry.child < 0) {
+                break;
+            }
+            node = entry.child;
+        }
+
+        return result;
+    }
+
+} // namespace Netvisix
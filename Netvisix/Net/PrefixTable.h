@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PREFIXTABLE_H
+#define PREFIXTABLE_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // longest prefix match over addresses of a fixed byte length (multibit trie,
+    // 8 bit strides with expanded prefixes: at most one step per address byte)
+    class PrefixTable {
+
+        public:
+            PrefixTable(unsigned int addrBytes);
+            virtual ~PrefixTable();
+
+            // (value >= 0, e.g. an index into a subnet list)
+            void insert(const uint8_t* addr, unsigned int prefixLength, int value);
+
+            // value of the longest matching prefix or -1
+            int lookup(const uint8_t* addr) const;
+
+            void clear();
+
+            size_t getMemoryUsage() const { return this->entries.capacity() * sizeof(Entry); }
+
+        private:
+            struct Entry {
+                int32_t child;
+                int16_t value;
+                uint8_t prefixLength;
+            };
+
+            int addNode();
+
+            unsigned int addrBytes;
+
+            std::vector<Entry> entries;
+            int defaultValue;
+
+            static const unsigned int STRIDE = 256;
+    };
+
+} // namespace Netvisix
+#endif // PREFIXTABLE_H
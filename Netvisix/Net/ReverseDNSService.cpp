@@ -0,0 +1,228 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ReverseDNSService.h"
+
+#include <QHostInfo>
+
+#include <algorithm>
+#include <iterator>
+#include <chrono>
+
+
+namespace Netvisix {
+
+    ReverseDNSService::ReverseDNSService(ResultHandler resultHandler) {
+        state = std::make_shared<State>();
+        state->resultHandler = resultHandler;
+        state->resolver = resolveHostname;
+        state->generation = 0;
+        state->isShutdown = false;
+        state->runningHandlers = 0;
+        state->rateLimit = RATE_LIMIT_DEFAULT;
+        state->nextRequestTime = 0;
+        concurrency = CONCURRENCY_DEFAULT;
+
+        startWorkers();
+    }
+
+    ReverseDNSService::~ReverseDNSService() {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->isShutdown = true;
+        state->queue.clear();
+        state->pending.clear();
+        lock.unlock();
+
+        stopWorkers();
+
+        // (answers being handed in right now, these do not block on the resolver)
+        lock.lock();
+        state->handlerCondition.wait(lock, [this] { return state->runningHandlers == 0; });
+    }
+
+    std::string ReverseDNSService::resolveHostname(const std::string& ipAddr) {
+        QHostInfo hostInfo = QHostInfo::fromName(ipAddr.c_str());
+        if (hostInfo.error() != QHostInfo::NoError) {
+            return "";
+        }
+
+        // (the address itself if there is no ptr record)
+        std::string hostname = hostInfo.hostName().toStdString();
+        return (hostname != ipAddr) ? hostname : "";
+    }
+
+    long long ReverseDNSService::getCurrentTime() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    long long ReverseDNSService::getCurrentTimeMicroseconds() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    std::string ReverseDNSService::request(const std::string& ipAddr) {
+        std::string hostname = "";
+
+        state->mutex.lock();
+        auto it = state->cache.find(ipAddr);
+        if (it != state->cache.end() && it->second.expiryTime > getCurrentTime()) {
+            hostname = it->second.hostname;
+        }
+        else if (state->queue.size() < QUEUE_MAX && state->pending.insert(ipAddr).second) {
+            state->queue.push_back(ipAddr);
+            state->queueCondition.notify_one();
+        }
+        state->mutex.unlock();
+
+        return hostname;
+    }
+
+    void ReverseDNSService::setResolver(Resolver resolver) {
+        state->mutex.lock();
+        state->resolver = resolver;
+        state->mutex.unlock();
+    }
+
+    void ReverseDNSService::setConcurrency(unsigned int concurrency) {
+        if (concurrency == 0 || concurrency == this->concurrency) {
+            return;
+        }
+
+        // (running lookups of the old workers still deliver their results)
+        stopWorkers();
+        this->concurrency = concurrency;
+        startWorkers();
+    }
+
+    unsigned int ReverseDNSService::getRateLimit() {
+        state->mutex.lock();
+        unsigned int rateLimit = state->rateLimit;
+        state->mutex.unlock();
+
+        return rateLimit;
+    }
+
+    void ReverseDNSService::setRateLimit(unsigned int requestsPerSecond) {
+        state->mutex.lock();
+        state->rateLimit = std::max(requestsPerSecond, 1u);
+        state->mutex.unlock();
+    }
+
+    void ReverseDNSService::clear() {
+        state->mutex.lock();
+        state->queue.clear();
+        state->pending.clear();
+        state->cache.clear();
+        state->mutex.unlock();
+    }
+
+    size_t ReverseDNSService::getMemoryUsage() {
+        state->mutex.lock();
+        size_t memoryUsage = sizeof(ReverseDNSService) + sizeof(State)
+                + state->cache.bucket_count() * sizeof(void*) + state->pending.bucket_count() * sizeof(void*);
+        for (const auto& entry : state->cache) {
+            memoryUsage += sizeof(entry) + entry.first.capacity() + entry.second.hostname.capacity();
+        }
+        memoryUsage += (state->queue.size() + state->pending.size()) * (sizeof(std::string) + 16);
+        state->mutex.unlock();
+
+        return memoryUsage;
+    }
+
+    void ReverseDNSService::startWorkers() {
+        state->mutex.lock();
+        unsigned int generation = state->generation;
+        state->mutex.unlock();
+
+        for (unsigned int i = 0; i < concurrency; i++) {
+            std::thread(&ReverseDNSService::workerLoop, state, generation).detach();
+        }
+    }
+
+    void ReverseDNSService::stopWorkers() {
+        // (idle workers leave right away, busy ones after their lookup, nothing to wait for)
+        state->mutex.lock();
+        state->generation++;
+        state->queueCondition.notify_all();
+        state->mutex.unlock();
+    }
+
+    void ReverseDNSService::addCacheEntry(State& state, const std::string& ipAddr, const std::string& hostname, long long currentTime) {
+        if (state.cache.size() >= CACHE_MAX) {
+            for (auto it = state.cache.begin(); it != state.cache.end();) {
+                it = (it->second.expiryTime <= currentTime) ? state.cache.erase(it) : std::next(it);
+            }
+            if (state.cache.size() >= CACHE_MAX) {
+                state.cache.clear();
+            }
+        }
+
+        CacheEntry& entry = state.cache[ipAddr];
+        entry.hostname = hostname;
+        if (hostname.empty()) {
+            entry.expiryTime = currentTime + NEGATIVE_TTL;
+        }
+        else {
+            entry.expiryTime = currentTime + POSITIVE_TTL;
+        }
+    }
+
+    void ReverseDNSService::workerLoop(std::shared_ptr<State> state, unsigned int generation) {
+        std::unique_lock<std::mutex> lock(state->mutex);
+
+        while (true) {
+            state->queueCondition.wait(lock, [&state, generation] { return state->generation != generation || ! state->queue.empty(); });
+            if (state->generation != generation) {
+                return;
+            }
+
+            std::string ipAddr = state->queue.front();
+            state->queue.pop_front();
+
+            // requests per second (shared by all workers)
+            // (in microseconds, milliseconds would round the interval of more than 1000 per second to 0)
+            long long now = getCurrentTimeMicroseconds();
+            long long requestTime = std::max(now, state->nextRequestTime);
+            state->nextRequestTime = requestTime + 1000000 / state->rateLimit;
+            Resolver currentResolver = state->resolver;
+
+            lock.unlock();
+            if (requestTime > now) {
+                std::this_thread::sleep_for(std::chrono::microseconds(requestTime - now));
+            }
+            std::string hostname = currentResolver(ipAddr);
+            lock.lock();
+
+            // (cleared or shut down meanwhile)
+            if (state->isShutdown || state->pending.erase(ipAddr) == 0) {
+                continue;
+            }
+            addCacheEntry(*state, ipAddr, hostname, getCurrentTime());
+
+            if (hostname.empty() == false) {
+                state->runningHandlers++;
+                lock.unlock();
+                state->resultHandler(ipAddr, hostname);
+                lock.lock();
+                state->runningHandlers--;
+                state->handlerCondition.notify_all();
+            }
+        }
+    }
+
+} // namespace Netvisix
@@ -0,0 +1,119 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef REVERSEDNSSERVICE_H
+#define REVERSEDNSSERVICE_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace Netvisix {
+
+    // reverse dns lookups on worker threads: bounded queue (deduplicated), limited concurrency and
+    // requests per second, positive & negative results cached by ip address
+    // (workers are never joined, a lookup may block for the resolver timeout: stopped workers finish
+    // their lookup detached and keep the shared state alive until then)
+    class ReverseDNSService {
+
+        public:
+            // blocking lookup, "" if there is no name (replaceable, e.g. by a local stub resolver)
+            typedef std::string (*Resolver)(const std::string& ipAddr);
+            // (worker thread, never called with the service lock held)
+            typedef void (*ResultHandler)(const std::string& ipAddr, const std::string& hostname);
+
+            ReverseDNSService(ResultHandler resultHandler);
+            virtual ~ReverseDNSService();
+
+            // (any thread) returns a cached name, otherwise "" and the lookup is queued (unless known as negative)
+            std::string request(const std::string& ipAddr);
+
+            void setResolver(Resolver resolver);
+
+            unsigned int getConcurrency() { return this->concurrency; }
+            void setConcurrency(unsigned int concurrency);
+
+            unsigned int getRateLimit();
+            void setRateLimit(unsigned int requestsPerSecond);
+
+            // drops the queue & the cache
+            void clear();
+
+            size_t getMemoryUsage();
+
+            static std::string resolveHostname(const std::string& ipAddr);
+
+        private:
+            struct CacheEntry {
+                std::string hostname;
+                long long expiryTime;
+            };
+
+            // (shared with the workers)
+            struct State {
+                ResultHandler resultHandler;
+                Resolver resolver;
+
+                std::mutex mutex;
+                std::condition_variable queueCondition;
+                std::condition_variable handlerCondition;
+                std::deque<std::string> queue;
+                std::unordered_set<std::string> pending;
+                std::unordered_map<std::string, CacheEntry> cache;
+
+                // (workers of an older generation leave after their current lookup)
+                unsigned int generation;
+                // (no more results after shutdown, the destructor waits for running result handlers)
+                bool isShutdown;
+                unsigned int runningHandlers;
+
+                unsigned int rateLimit;
+                // (microseconds)
+                long long nextRequestTime;
+            };
+
+            void startWorkers();
+            void stopWorkers();
+            static void workerLoop(std::shared_ptr<State> state, unsigned int generation);
+
+            static void addCacheEntry(State& state, const std::string& ipAddr, const std::string& hostname, long long currentTime);
+
+            static long long getCurrentTime();
+            static long long getCurrentTimeMicroseconds();
+
+            std::shared_ptr<State> state;
+            unsigned int concurrency;
+
+            static const unsigned int CONCURRENCY_DEFAULT = 4;
+            static const unsigned int RATE_LIMIT_DEFAULT = 20;
+            static const size_t QUEUE_MAX = 4096;
+            static const size_t CACHE_MAX = 65536;
+            static const long long POSITIVE_TTL = 60 * 60 * 1000;
+            static const long long NEGATIVE_TTL = 5 * 60 * 1000;
+    };
+
+} // namespace Netvisix
+#endif // REVERSEDNSSERVICE_H
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ServiceTable.h"
+
+
+namespace Netvisix {
+
+    uint8_t ServiceTable::tableTCP[65536] = {};
+    uint8_t ServiceTable::tableUDP[65536] = {};
+    ServiceTable::Initializer ServiceTable::initializer;
+
+    ServiceTable::Initializer::Initializer() {
+        add(Service::HTTP, true, false, { 80, 8000, 8008, 8080, 8081, 8888 });
+        add(Service::TLS, true, false, { 443, 8443 });
+        add(Service::QUIC, false, true, { 443 });
+        add(Service::SSH, true, false, { 22 });
+        add(Service::Telnet, true, false, { 23 });
+        add(Service::FTP, true, false, { 20, 21, 989, 990 });
+        add(Service::Mail, true, false, { 25, 110, 143, 465, 587, 993, 995 });
+        add(Service::DNS, true, true, { 53, 853, 5353, 5355 });
+        add(Service::DHCP, false, true, { 67, 68, 546, 547 });
+        add(Service::NTP, false, true, { 123 });
+        // (netbios name, datagram & session service)
+        add(Service::SMB, true, true, { 137, 138, 139, 445 });
+        add(Service::LDAP, true, true, { 389, 636, 3268, 3269 });
+        // (rdp & vnc)
+        add(Service::RDP, true, true, { 3389, 5900, 5901, 5902, 5903 });
+        add(Service::Database, true, false, { 1433, 1521, 3306, 5432, 5984, 6379, 9042, 11211, 27017 });
+        add(Service::SNMP, false, true, { 161, 162 });
+        // (pptp, l2tp, ike, openvpn, wireguard)
+        add(Service::VPN, true, false, { 1723, 1194 });
+        add(Service::VPN, false, true, { 500, 1194, 1701, 4500, 51820 });
+        // (sip, stun)
+        add(Service::VoIP, true, true, { 3478, 5060, 5061 });
+    }
+
+    void ServiceTable::add(Service service, bool isTCP, bool isUDP, std::initializer_list<uint16_t> ports) {
+        for (uint16_t port : ports) {
+            if (isTCP) {
+                tableTCP[port] = (uint8_t) service;
+            }
+            if (isUDP) {
+                tableUDP[port] = (uint8_t) service;
+            }
+        }
+    }
+
+    std::string ServiceTable::getServiceString(Service service) {
+        switch (service) {
+        case Service::HTTP:
+            return "HTTP";
+        case Service::TLS:
+            return "TLS";
+        case Service::QUIC:
+            return "QUIC";
+        case Service::SSH:
+            return "SSH";
+        case Service::Telnet:
+            return "Telnet";
+        case Service::FTP:
+            return "FTP";
+        case Service::Mail:
+            return "Mail";
+        case Service::DNS:
+            return "DNS";
+        case Service::DHCP:
+            return "DHCP";
+        case Service::NTP:
+            return "NTP";
+        case Service::SMB:
+            return "SMB";
+        case Service::LDAP:
+            return "LDAP";
+        case Service::RDP:
+            return "RDP / VNC";
+        case Service::Database:
+            return "Database";
+        case Service::SNMP:
+            return "SNMP";
+        case Service::VPN:
+            return "VPN";
+        case Service::VoIP:
+            return "VoIP";
+
+        default:
+            return "";
+        }
+    }
+
+} // namespace Netvisix
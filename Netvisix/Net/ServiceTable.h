@@ -0,0 +1,73 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SERVICETABLE_H
+#define SERVICETABLE_H
+
+#include "Net/NetEvent.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+
+namespace Netvisix {
+
+    // port based service classification, one byte per port and transport protocol
+    // (two 64k tables filled once at startup, a lookup is a single load per port)
+    class ServiceTable {
+
+        public:
+            // the known port of the lower side wins, a known port of the higher side only
+            // counts below EPHEMERAL_PORT_MIN (else it is most likely the client port)
+            static Service getService(bool isUDP, uint16_t sport, uint16_t dport) {
+                const uint8_t* table = isUDP ? tableUDP : tableTCP;
+                uint16_t lowPort = (sport < dport) ? sport : dport;
+                uint16_t highPort = (sport < dport) ? dport : sport;
+
+                Service service = (Service) table[lowPort];
+                if (service == Service::None && highPort < EPHEMERAL_PORT_MIN) {
+                    service = (Service) table[highPort];
+                }
+                return service;
+            }
+
+            static bool getIsKnownPort(bool isUDP, uint16_t port) {
+                return (isUDP ? tableUDP : tableTCP)[port] != (uint8_t) Service::None;
+            }
+
+            static std::string getServiceString(Service service);
+
+            static const unsigned int SERVICE_COUNT = (unsigned int) Service::VoIP + 1;
+            static const uint16_t EPHEMERAL_PORT_MIN = 32768;
+
+        private:
+            struct Initializer {
+                Initializer();
+            };
+
+            static void add(Service service, bool isTCP, bool isUDP, std::initializer_list<uint16_t> ports);
+
+            static uint8_t tableTCP[65536];
+            static uint8_t tableUDP[65536];
+            static Initializer initializer;
+    };
+
+} // namespace Netvisix
+#endif // SERVICETABLE_H
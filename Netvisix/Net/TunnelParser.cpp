@@ -0,0 +1,308 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TunnelParser.h"
+
+
+namespace Netvisix {
+
+    bool TunnelParser::parseUDP(uint16_t dport, const uint8_t* data, size_t size, Inner& inner) {
+        clear(inner);
+        return parseUDP(dport, data, size, inner, 0);
+    }
+
+    bool TunnelParser::parseIP(uint8_t protocol, const uint8_t* data, size_t size, Inner& inner) {
+        clear(inner);
+        return parseIP(protocol, data, size, inner, 0);
+    }
+
+    bool TunnelParser::parseUDP(uint16_t dport, const uint8_t* data, size_t size, Inner& inner, unsigned int depth) {
+        if (depth >= DEPTH_MAX) {
+            return false;
+        }
+
+        // vxlan: flags (I), reserved, vni, reserved
+        if (dport == PORT_VXLAN) {
+            if (size < 8 || (data[0] & 0x08) == 0) {
+                return false;
+            }
+            setTunnel(inner, Tunnel::VXLAN, ((uint32_t) data[4] << 16) | (data[5] << 8) | data[6]);
+            return parsePayload(ETHER_TYPE_TEB, data + 8, size - 8, inner, depth + 1);
+        }
+        // geneve: version & options length, flags, protocol type, vni, reserved, options
+        else if (dport == PORT_GENEVE) {
+            if (size < 8 || (data[0] >> 6) != 0) {
+                return false;
+            }
+            size_t headerSize = 8 + (data[0] & 0x3f) * 4;
+            if (size < headerSize) {
+                return false;
+            }
+            setTunnel(inner, Tunnel::GENEVE, ((uint32_t) data[4] << 16) | (data[5] << 8) | data[6]);
+            return parsePayload(read16(data + 2), data + headerSize, size - headerSize, inner, depth + 1);
+        }
+
+        return false;
+    }
+
+    bool TunnelParser::parseIP(uint8_t protocol, const uint8_t* data, size_t size, Inner& inner, unsigned int depth) {
+        if (depth >= DEPTH_MAX) {
+            return false;
+        }
+
+        if (protocol == PROTOCOL_GRE) {
+            return parseGRE(data, size, inner, depth);
+        }
+        else if (protocol == PROTOCOL_IPIP) {
+            setTunnel(inner, Tunnel::IPinIP, 0);
+            return parseIPHeader(ETHER_TYPE_IPV4, data, size, inner, depth + 1);
+        }
+        else if (protocol == PROTOCOL_IPV6) {
+            setTunnel(inner, Tunnel::IPinIP, 0);
+            return parseIPHeader(ETHER_TYPE_IPV6, data, size, inner, depth + 1);
+        }
+
+        return false;
+    }
+
+    bool TunnelParser::parseGRE(const uint8_t* data, size_t size, Inner& inner, unsigned int depth) {
+        if (size < 4) {
+            return false;
+        }
+
+        // (version 1 is pptp, no inner frames)
+        uint16_t flags = read16(data);
+        if ((flags & 0x0007) != 0) {
+            return false;
+        }
+        uint16_t etherType = read16(data + 2);
+
+        // checksum, key, sequence number
+        size_t offset = 4;
+        uint32_t key = 0;
+        bool hasSequence = (flags & 0x1000) != 0;
+        if (flags & 0x8000) {
+            offset += 4;
+        }
+        if (flags & 0x2000) {
+            if (size < offset + 4) {
+                return false;
+            }
+            key = read32(data + offset);
+            offset += 4;
+        }
+        if (hasSequence) {
+            offset += 4;
+        }
+        if (size < offset) {
+            return false;
+        }
+
+        // erspan (type i has no header and no sequence number, type ii / iii carry the session id)
+        if (etherType == ETHER_TYPE_ERSPAN_2 || etherType == ETHER_TYPE_ERSPAN_3) {
+            size_t headerSize = 0;
+            uint32_t sessionID = 0;
+            if (etherType == ETHER_TYPE_ERSPAN_3 || hasSequence) {
+                headerSize = (etherType == ETHER_TYPE_ERSPAN_2) ? 8 : 12;
+                if (size < offset + headerSize) {
+                    return false;
+                }
+                sessionID = read16(data + offset + 2) & 0x03ff;
+
+                // (type iii optional platform specific subheader)
+                if (etherType == ETHER_TYPE_ERSPAN_3 && (data[offset + 11] & 0x01)) {
+                    headerSize += 8;
+                    if (size < offset + headerSize) {
+                        return false;
+                    }
+                }
+            }
+            setTunnel(inner, Tunnel::ERSPAN, sessionID);
+            return parsePayload(ETHER_TYPE_TEB, data + offset + headerSize, size - offset - headerSize, inner, depth + 1);
+        }
+
+        setTunnel(inner, Tunnel::GRE, key);
+        return parsePayload(etherType, data + offset, size - offset, inner, depth + 1);
+    }
+
+    bool TunnelParser::parsePayload(uint16_t etherType, const uint8_t* data, size_t size, Inner& inner, unsigned int depth) {
+        // ethernet (with up to VLAN_TAGS_MAX 802.1Q tags)
+        if (etherType == ETHER_TYPE_TEB) {
+            if (size < ETHERNET_HEADER_SIZE) {
+                return false;
+            }
+            inner.dstAddrHW = data;
+            inner.srcAddrHW = data + 6;
+            etherType = read16(data + 12);
+
+            size_t offset = ETHERNET_HEADER_SIZE;
+            for (unsigned int i = 0; i < VLAN_TAGS_MAX && (etherType == ETHER_TYPE_VLAN || etherType == ETHER_TYPE_QINQ); i++) {
+                if (size < offset + 4) {
+                    return false;
+                }
+                etherType = read16(data + offset + 2);
+                offset += 4;
+            }
+            data += offset;
+            size -= offset;
+        }
+
+        // mpls label stack (the payload has no type field, take the ip version)
+        if (etherType == ETHER_TYPE_MPLS || etherType == ETHER_TYPE_MPLS_MULTICAST) {
+            size_t offset = 0;
+            bool isBottom = false;
+            for (unsigned int i = 0; i < MPLS_LABELS_MAX && isBottom == false; i++) {
+                if (size < offset + 4) {
+                    return false;
+                }
+                isBottom = (data[offset + 2] & 0x01) != 0;
+                offset += 4;
+            }
+            if (isBottom == false || size <= offset) {
+                return false;
+            }
+
+            uint8_t ipVersion = data[offset] >> 4;
+            etherType = (ipVersion == 4) ? ETHER_TYPE_IPV4 : ((ipVersion == 6) ? ETHER_TYPE_IPV6 : 0);
+            data += offset;
+            size -= offset;
+        }
+
+        if (etherType == ETHER_TYPE_ARP) {
+            inner.etherType = ETHER_TYPE_ARP;
+            inner.payload = data;
+            inner.payloadSize = size;
+            return true;
+        }
+        else if (etherType == ETHER_TYPE_IPV4 || etherType == ETHER_TYPE_IPV6) {
+            return parseIPHeader(etherType, data, size, inner, depth);
+        }
+
+        return false;
+    }
+
+    bool TunnelParser::parseIPHeader(uint16_t etherType, const uint8_t* data, size_t size, Inner& inner, unsigned int depth) {
+        uint8_t protocol = 0;
+        size_t headerSize = 0;
+        bool isFragment = false;
+
+        if (etherType == ETHER_TYPE_IPV4) {
+            if (size < 20 || (data[0] >> 4) != 4) {
+                return false;
+            }
+            headerSize = (data[0] & 0x0f) * 4;
+            size_t totalLength = read16(data + 2);
+            if (headerSize < 20 || size < headerSize || totalLength < headerSize) {
+                return false;
+            }
+            // (ethernet padding)
+            if (totalLength < size) {
+                size = totalLength;
+            }
+
+            inner.srcAddr = data + 12;
+            inner.dstAddr = data + 16;
+            protocol = data[9];
+            isFragment = (read16(data + 6) & 0x1fff) != 0;
+        }
+        else {
+            if (size < IPV6_HEADER_SIZE || (data[0] >> 4) != 6) {
+                return false;
+            }
+            headerSize = IPV6_HEADER_SIZE;
+            size_t totalLength = IPV6_HEADER_SIZE + read16(data + 4);
+            if (totalLength < size) {
+                size = totalLength;
+            }
+
+            inner.srcAddr = data + 8;
+            inner.dstAddr = data + 24;
+            protocol = data[6];
+
+            // hop-by-hop, routing, fragment, destination options
+            for (unsigned int i = 0; i < IPV6_EXTENSIONS_MAX && (protocol == 0 || protocol == 43 || protocol == 44 || protocol == 60); i++) {
+                if (size < headerSize + 8) {
+                    return false;
+                }
+                uint8_t nextProtocol = data[headerSize];
+                if (protocol == 44) {
+                    isFragment = (read16(data + headerSize + 2) & 0xfff8) != 0;
+                    headerSize += 8;
+                }
+                else {
+                    headerSize += (data[headerSize + 1] + 1) * 8;
+                }
+                protocol = nextProtocol;
+            }
+            if (size < headerSize) {
+                return false;
+            }
+        }
+
+        inner.etherType = etherType;
+        inner.protocol = protocol;
+        inner.payload = data + headerSize;
+        inner.payloadSize = isFragment ? 0 : size - headerSize;
+
+        // nested tunnel (the outer ethernet addresses belong to the tunnel endpoint then)
+        if (inner.payloadSize > 0 && depth < DEPTH_MAX) {
+            Inner nested = inner;
+            nested.srcAddrHW = nullptr;
+            nested.dstAddrHW = nullptr;
+
+            bool isNested = false;
+            if (protocol == PROTOCOL_GRE || protocol == PROTOCOL_IPIP || protocol == PROTOCOL_IPV6) {
+                isNested = parseIP(protocol, inner.payload, inner.payloadSize, nested, depth);
+            }
+            else if (protocol == PROTOCOL_UDP && inner.payloadSize >= 8) {
+                uint16_t dport = read16(inner.payload + 2);
+                if (dport == PORT_VXLAN || dport == PORT_GENEVE) {
+                    isNested = parseUDP(dport, inner.payload + 8, inner.payloadSize - 8, nested, depth);
+                }
+            }
+
+            if (isNested) {
+                inner = nested;
+            }
+        }
+
+        return true;
+    }
+
+    void TunnelParser::setTunnel(Inner& inner, Tunnel tunnel, uint32_t tunnelID) {
+        if (inner.tunnel == Tunnel::None) {
+            inner.tunnel = tunnel;
+            inner.tunnelID = tunnelID;
+        }
+    }
+
+    void TunnelParser::clear(Inner& inner) {
+        inner.tunnel = Tunnel::None;
+        inner.tunnelID = 0;
+        inner.srcAddrHW = nullptr;
+        inner.dstAddrHW = nullptr;
+        inner.etherType = 0;
+        inner.srcAddr = nullptr;
+        inner.dstAddr = nullptr;
+        inner.protocol = 0;
+        inner.payload = nullptr;
+        inner.payloadSize = 0;
+    }
+
+} // namespace Netvisix
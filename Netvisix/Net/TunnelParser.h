@@ -0,0 +1,111 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TUNNELPARSER_H
+#define TUNNELPARSER_H
+
+#include "Net/NetEvent.h"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace Netvisix {
+
+    // tunnel header walker working on the raw payload (no copies, no heap allocations),
+    // finds the inner ethernet / ip header of vxlan, geneve, gre (incl. erspan and mpls over gre)
+    // and ip-in-ip encapsulations, nested tunnels are followed up to DEPTH_MAX levels
+    class TunnelParser {
+
+        public:
+            struct Inner {
+                // outermost tunnel (the one between the outer endpoints)
+                Tunnel tunnel;
+                uint32_t tunnelID;
+
+                // innermost ethernet header (nullptr if the inner payload is plain ip)
+                const uint8_t* srcAddrHW;
+                const uint8_t* dstAddrHW;
+
+                // ipv4, ipv6 or arp (ethernet type values)
+                uint16_t etherType;
+
+                // 4 or 16 bytes by etherType (nullptr for arp)
+                const uint8_t* srcAddr;
+                const uint8_t* dstAddr;
+
+                // ip protocol / next header and its payload
+                uint8_t protocol;
+                const uint8_t* payload;
+                size_t payloadSize;
+            };
+
+            // outer udp payload (vxlan, geneve), false if not a known tunnel
+            static bool parseUDP(uint16_t dport, const uint8_t* data, size_t size, Inner& inner);
+
+            // outer ip payload (gre, ip-in-ip)
+            static bool parseIP(uint8_t protocol, const uint8_t* data, size_t size, Inner& inner);
+
+            static uint16_t read16(const uint8_t* data) { return (data[0] << 8) | data[1]; }
+
+            static const uint16_t PORT_VXLAN = 4789;
+            static const uint16_t PORT_GENEVE = 6081;
+
+            static const uint8_t PROTOCOL_IPIP = 4;
+            static const uint8_t PROTOCOL_TCP = 6;
+            static const uint8_t PROTOCOL_UDP = 17;
+            static const uint8_t PROTOCOL_IPV6 = 41;
+            static const uint8_t PROTOCOL_GRE = 47;
+
+            static const uint16_t ETHER_TYPE_IPV4 = 0x0800;
+            static const uint16_t ETHER_TYPE_ARP = 0x0806;
+            static const uint16_t ETHER_TYPE_IPV6 = 0x86dd;
+
+        private:
+            static bool parseUDP(uint16_t dport, const uint8_t* data, size_t size, Inner& inner, unsigned int depth);
+            static bool parseIP(uint8_t protocol, const uint8_t* data, size_t size, Inner& inner, unsigned int depth);
+            static bool parseGRE(const uint8_t* data, size_t size, Inner& inner, unsigned int depth);
+
+            // inner payload by ethernet type (ethernet, mpls, ip), follows further tunnels
+            static bool parsePayload(uint16_t etherType, const uint8_t* data, size_t size, Inner& inner, unsigned int depth);
+            static bool parseIPHeader(uint16_t etherType, const uint8_t* data, size_t size, Inner& inner, unsigned int depth);
+
+            static void setTunnel(Inner& inner, Tunnel tunnel, uint32_t tunnelID);
+            static void clear(Inner& inner);
+
+            static uint32_t read32(const uint8_t* data) { return ((uint32_t) read16(data) << 16) | read16(data + 2); }
+
+            static const uint16_t ETHER_TYPE_TEB = 0x6558;
+            static const uint16_t ETHER_TYPE_VLAN = 0x8100;
+            static const uint16_t ETHER_TYPE_QINQ = 0x88a8;
+            static const uint16_t ETHER_TYPE_MPLS = 0x8847;
+            static const uint16_t ETHER_TYPE_MPLS_MULTICAST = 0x8848;
+            static const uint16_t ETHER_TYPE_ERSPAN_2 = 0x88be;
+            static const uint16_t ETHER_TYPE_ERSPAN_3 = 0x22eb;
+
+            static const unsigned int ETHERNET_HEADER_SIZE = 14;
+            static const unsigned int IPV6_HEADER_SIZE = 40;
+            static const unsigned int DEPTH_MAX = 4;
+            static const unsigned int MPLS_LABELS_MAX = 8;
+            static const unsigned int VLAN_TAGS_MAX = 2;
+            static const unsigned int IPV6_EXTENSIONS_MAX = 4;
+    };
+
+} // namespace Netvisix
+#endif // TUNNELPARSER_H
@@ -19,17 +19,22 @@
 
 #include "NetView.h"
 #include "Config.h"
-#include "Net/NetUtil.h"
 #include "Net/NetEventManager.h"
 #include "Net/Host.h"
 #include "GUI/VisibleHost.h"
-#include "GUI/VisiblePacket.h"
+#include "GUI/PacketParticleSystem.h"
 #include "GUI/HostInfoPopup.h"
-#include "GUI/VisibleLink.h"
+#include "GUI/VisibleLinkPool.h"
+#include "GUI/SpatialGrid.h"
+#include "GUI/ForceLayout.h"
+#include "GUI/FrameScheduler.h"
 
 #include <QtWidgets>
 #include <QtDebug>
 
+#include <algorithm>
+#include <unordered_set>
+
 
 namespace Netvisix {
 
@@ -43,40 +48,45 @@ namespace Netvisix {
         setPalette(Pal);
 
         lanAreaBrush = QBrush(theme->lanAreaColor, Qt::BrushStyle::SolidPattern);
+
+        forceLayout = new ForceLayout();
+        forceLayoutEnabled = false;
+        serviceColorsEnabled = true;
+
+        frameScheduler = nullptr;
+        renderQuality = RenderQuality::High;
+
         updateLanAreaRect();
 
         visibleHosts = new std::vector<VisibleHost*>();
-        visiblePackets = new std::vector<VisiblePacket*>();
+        hostTargetGrid = new SpatialGrid(64);
+        hostPositionGrid = new SpatialGrid(64);
 
-        visiblePacketsBuffer = new std::vector<VisiblePacket*>();
+        packetParticles = new PacketParticleSystem();
         packetBufferTimer = 0;
 
-        int linkInstancesMax = 40;
-        visibleLinks = new std::vector<VisibleLink*>();
-        for (int i = 0; i < linkInstancesMax; i++) {
-            visibleLinks->push_back(new VisibleLink(this));
-        }
+        visibleLinkPool = new VisibleLinkPool(this);
 
         NetEventManager::SharedInstance()->addPreparedNetEventListener(this);
+        NetEventManager::SharedInstance()->addHostRemovalListener(this);
 
         hostInfoPopup = nullptr;
 
-        reverseDNSLookupEnabled = false;
 
         setIsPaused(false);
     }
 
     NetView::~NetView() {
+        forceLayout->stop();
         reset();
+        delete forceLayout;
 
         delete visibleHosts;
-        delete visiblePackets;
-        delete visiblePacketsBuffer;
+        delete hostTargetGrid;
+        delete hostPositionGrid;
+        delete packetParticles;
 
-        for (unsigned int i = 0; i < visibleLinks->size(); i++) {
-            delete visibleLinks->at(i);
-        }
-        delete visibleLinks;
+        delete visibleLinkPool;
     }
 
     void NetView::reset() {
@@ -85,57 +95,72 @@ namespace Netvisix {
             delete visibleHosts->at(i);
         }
         visibleHosts->clear();
+        visibleHostsByID.clear();
+        hostTargetGrid->clear();
+        hostPositionGrid->clear();
+        forceLayout->reset();
+        layoutPositions.clear();
 
-        for (unsigned int i = 0; i < visiblePackets->size(); i++) {
-            delete visiblePackets->at(i);
-        }
-        visiblePackets->clear();
-
-        for (unsigned int i = 0; i < visiblePacketsBuffer->size(); i++) {
-            delete visiblePacketsBuffer->at(i);
-        }
-        visiblePacketsBuffer->clear();
+        packetParticles->clear();
 
-        for (unsigned int i = 0; i < visibleLinks->size(); i++) {
-            VisibleLink* vLink = visibleLinks->at(i);
-            vLink->setIsActive(false);
-        }
+        visibleLinkPool->clear();
 
         setIsPaused(false);
         mutex.unlock();
     }
 
+    unsigned int NetView::getActivePacketsCount() {
+        return packetParticles->size();
+    }
+
     VisibleHost* NetView::getVisibleHost(Host *host) {
-        for (unsigned int i = 0; i < visibleHosts->size(); i++) {
-            VisibleHost* vHost = visibleHosts->at(i);
-            if (vHost->getHost() == host) {
-                return vHost;
-            }
+        if (host == nullptr) {
+            return nullptr;
         }
 
-        return nullptr;
-    }
+        VisibleHost* vHost = nullptr;
 
-    void NetView::onPreparedNetEventNewHost(Host* newHost) {
-        VisibleHost* newVH = new VisibleHost(this, newHost);
-
-        if (reverseDNSLookupEnabled && newHost->getHostname() == "") {
-            reverseDNSLookup(newHost);
+        mutex.lock();
+        unsigned int id = host->getID();
+        if (id < visibleHostsByID.size()) {
+            vHost = visibleHostsByID[id];
         }
+        mutex.unlock();
+
+        return vHost;
+    }
 
+    void NetView::onPreparedNetEventNewHost(Host* newHost) {
         mutex.lock();
+        VisibleHost* newVH = new VisibleHost(this, newHost);
+        newVH->setLayoutIndex(forceLayout->addNode(newHost->getNetArea(), newVH->getTargetPosition()));
         visibleHosts->push_back(newVH);
+        if (newHost->getID() >= visibleHostsByID.size()) {
+            visibleHostsByID.resize(newHost->getID() + 1, nullptr);
+        }
+        visibleHostsByID[newHost->getID()] = newVH;
+        hostTargetGrid->insert(newVH, newVH->getTargetPosition(), getCollisionRadius(newVH));
+        hostPositionGrid->insert(newVH, newVH->getPosition(), newVH->getRadius());
         mutex.unlock();
     }
 
     void NetView::onPreparedNetEventNewUnicastPacket(Host* sender, Host* receiver, NetEvent* netEvent) {
         VisibleHost* vhSender = getVisibleHost(sender);
         VisibleHost* vhReceiver = getVisibleHost(receiver);
+        if (vhSender == nullptr || vhReceiver == nullptr) {
+            qDebug() << "Missing VisibleHost!!!";
+            delete netEvent;
+            return;
+        }
+
+        vhSender->showHostAliveEffect();
 
-        VisiblePacket* newVP = new VisiblePacket(this, vhSender, vhReceiver, netEvent);
         mutex.lock();
-        visiblePacketsBuffer->push_back(newVP);
+        Service service = serviceColorsEnabled ? netEvent->service : Service::None;
+        packetParticles->addToBuffer(vhSender, vhReceiver, netEvent->getTopLevelProtocol(), service, netEvent->isIPv6());
         mutex.unlock();
+
+        delete netEvent;
     }
 
     void NetView::onPreparedNetEventNewMulticastPacket(Host* sender, NetEvent* netEvent) {
@@ -149,49 +174,81 @@ namespace Netvisix {
         vhSender->showHostAliveEffect();
     }
 
-    void NetView::setReverseDNSLookupEnabled(bool enabled) {
-        reverseDNSLookupEnabled = enabled;
-        if (enabled) {
-            for (unsigned int i = 0; i < visibleHosts->size(); i++) {
-                VisibleHost* v = visibleHosts->at(i);
-                if (v->getHost()->getHostname() == "") {
-                    reverseDNSLookup(v->getHost());
-                }
+    void NetView::onHostsRemoved(const std::vector<Host*>& hosts) {
+        if (hostInfoPopup != nullptr && std::find(hosts.begin(), hosts.end(), hostInfoPopup->getHost()) != hosts.end()) {
+            hostInfoPopup->close();
+            hostInfoPopup = nullptr;
+        }
+
+        mutex.lock();
+        std::unordered_set<VisibleHost*> removed;
+        for (Host* host : hosts) {
+            unsigned int id = host->getID();
+            if (id >= visibleHostsByID.size() || visibleHostsByID[id] == nullptr) {
+                continue;
             }
+
+            VisibleHost* vHost = visibleHostsByID[id];
+            visibleHostsByID[id] = nullptr;
+            removed.insert(vHost);
+
+            hostTargetGrid->remove(vHost);
+            hostPositionGrid->remove(vHost);
+            forceLayout->removeNode(vHost->getLayoutIndex());
         }
-    }
 
-    void NetView::reverseDNSLookup(Host* host) {
-        if (host->getAddrListIPv4().size() > 0) {
-            QHostInfo::lookupHost(host->getAddrListIPv4().at(0).to_string().c_str(), this, SLOT(onReverseDNSLookupAnswer(QHostInfo)));
-        } else if (host->getAddrListIPv6().size() > 0) {
-            QHostInfo::lookupHost(host->getAddrListIPv6().at(0).to_string().c_str(), this, SLOT(onReverseDNSLookupAnswer(QHostInfo)));
+        packetParticles->removeHosts(removed);
+        visibleLinkPool->removeHosts(removed);
+
+        visibleHosts->erase(std::remove_if(visibleHosts->begin(), visibleHosts->end(), [&removed](VisibleHost* v) {
+            return removed.count(v) > 0;
+        }), visibleHosts->end());
+        mutex.unlock();
+
+        for (VisibleHost* vHost : removed) {
+            delete vHost;
         }
     }
 
-    void NetView::onReverseDNSLookupAnswer(QHostInfo hostInfo) {
-        if (hostInfo.error() != QHostInfo::NoError || hostInfo.addresses().empty()) {
-            return;
+    void NetView::onHostsMerged(Host* host, const std::vector<Host*>& /*mergedHosts*/) {
+        VisibleHost* vHost = getVisibleHost(host);
+        if (vHost != nullptr) {
+            vHost->showHostAliveEffect();
         }
+    }
 
-        std::string queryIP = hostInfo.addresses().at(0).toString().toStdString();
-
-        for (unsigned int i = 0; i < visibleHosts->size(); i++) {
-            VisibleHost* v = visibleHosts->at(i);
+    size_t NetView::getMemoryUsage() {
+        mutex.lock();
+        size_t memoryUsage = visibleHostsByID.capacity() * sizeof(VisibleHost*)
+                + visibleHosts->capacity() * sizeof(VisibleHost*)
+                + hostTargetGrid->getMemoryUsage()
+                + hostPositionGrid->getMemoryUsage()
+                + packetParticles->getMemoryUsage()
+                + visibleLinkPool->getMemoryUsage();
+        for (VisibleHost* vHost : *visibleHosts) {
+            memoryUsage += vHost->getMemoryUsage();
+        }
+        mutex.unlock();
 
-            if (v->getHost()->getAddrIPv4(queryIP) != NetUtil::zeroAddrIPv4
-                    || v->getHost()->getAddrIPv6(queryIP) != NetUtil::zeroAddrIPv6) {
+        return memoryUsage;
+    }
 
-                std::string hostName = hostInfo.hostName().toStdString();
+    RenderQuality NetView::getRenderQuality() {
+        return renderQuality;
+    }
 
-                if (v->getHost()->getAddrIPv4(hostName) == NetUtil::zeroAddrIPv4
-                        && v->getHost()->getAddrIPv6(hostName) == NetUtil::zeroAddrIPv6) {
-                    v->getHost()->setHostname(hostName, true);
-                    v->getHost()->setHostnameIsFromReverseDNSLookp(true);
-                }
+    void NetView::setForceLayoutEnabled(bool enabled) {
+        if (enabled == forceLayoutEnabled) {
+            return;
+        }
 
-                break;
-            }
+        forceLayoutEnabled = enabled;
+        if (enabled) {
+            forceLayout->start();
+        }
+        else {
+            forceLayout->stop();
+            updateHostPositions();
         }
     }
 
@@ -205,9 +262,23 @@ namespace Netvisix {
         }
     }
 
+    void NetView::mouseDoubleClickEvent(QMouseEvent *event) {
+        QPoint mousePos = mapFromGlobal(QCursor::pos());
+
+        // prefix drill-down
+        VisibleHost* vHost = getHostAtPosition(mousePos, true);
+        if (vHost != nullptr && vHost->getHost()->getIsAggregate()) {
+            NetEventManager::SharedInstance()->expandAggregateHost(vHost->getHost());
+        }
+    }
+
     VisibleHost* NetView::getHostAtPosition(QPointF pos, bool visibleOnly) {
-        for (unsigned int i = 0; i < visibleHosts->size(); i++) {
-            VisibleHost* v = visibleHosts->at(i);
+        std::vector<VisibleHost*> candidates;
+        mutex.lock();
+        hostPositionGrid->getItems(QRectF(pos.x() - 0.5f, pos.y() - 0.5f, 1.0f, 1.0f), candidates);
+        mutex.unlock();
+
+        for (VisibleHost* v : candidates) {
             if (visibleOnly && ! v->getIsVisible()) {
                 continue;
             }
@@ -224,23 +295,24 @@ namespace Netvisix {
         return nullptr;
     }
 
+    float NetView::getCollisionRadius(VisibleHost* vHost) {
+        float radius = vHost->getRadius();
+        if (vHost->getHost()->getNetArea() == NetArea::LOCAL_INTERFACE) {
+            radius *= 5.0f;
+        }
+
+        return radius;
+    }
+
     bool NetView::isHostColliding(VisibleHost* vHost, QPointF targetPos, float radius) {
         // (checking target positions)
-        for (unsigned int i = 0; i < visibleHosts->size(); i++) {
-            VisibleHost* v = visibleHosts->at(i);
-            if (v == vHost) {
-                continue;
-            }
+        QRectF targetRect = QRectF(targetPos.x() - radius, targetPos.y() - radius, radius * 2, radius * 2);
 
-            float vRadius = v->getRadius();
-            if (v->getHost()->getNetArea() == NetArea::LOCAL_INTERFACE) {
-                vRadius *= 5.0f;
-            }
+        std::vector<VisibleHost*> candidates;
+        hostTargetGrid->getItems(targetRect, candidates);
 
-            QRectF vRect = QRectF(v->getTargetPosition().x() - vRadius, v->getTargetPosition().y() - vRadius, vRadius * 2, vRadius * 2);
-            QRectF targetRect = QRectF(targetPos.x() - radius, targetPos.y() - radius, radius * 2, radius * 2);
-
-            if (vRect.intersects(targetRect)) {
+        for (VisibleHost* v : candidates) {
+            if (v != vHost) {
                 return true;
             }
         }
@@ -313,6 +385,8 @@ namespace Netvisix {
         float innerWidth = (width / 2) * std::sqrt(2);
         float innerHeight = (height/ 2) * std::sqrt(2);
         lanAreaInnerRect = QRectF(size().width() / 2 - innerWidth / 2, size().height() / 2 - innerHeight / 2, innerWidth, innerHeight);
+
+        forceLayout->setBounds(QRectF(0, 0, size().width(), size().height()), lanAreaRect);
     }
 
     void NetView::resizeEvent(QResizeEvent *event) {
@@ -322,10 +396,30 @@ namespace Netvisix {
     }
 
     void NetView::updateHostPositions() {
+        mutex.lock();
         for (unsigned int i = 0; i < visibleHosts->size(); i++) {
             VisibleHost* v = visibleHosts->at(i);
             v->setTargetPosition(getFreeHostPosition(v));
+            hostTargetGrid->update(v, v->getTargetPosition(), getCollisionRadius(v));
         }
+        mutex.unlock();
+    }
+
+    void NetView::updateHostLayoutPositions() {
+        if (! forceLayout->getPositions(layoutPositions)) {
+            return;
+        }
+
+        mutex.lock();
+        for (unsigned int i = 0; i < visibleHosts->size(); i++) {
+            VisibleHost* v = visibleHosts->at(i);
+            int layoutIndex = v->getLayoutIndex();
+            if (layoutIndex >= 0 && layoutIndex < (int) layoutPositions.size()) {
+                v->setTargetPosition(layoutPositions.at(layoutIndex));
+                hostTargetGrid->update(v, v->getTargetPosition(), getCollisionRadius(v));
+            }
+        }
+        mutex.unlock();
     }
 
     void NetView::handleHostInfoPopup(quint64 dt) {
@@ -349,50 +443,9 @@ namespace Netvisix {
     }
 
     void NetView::showLink(VisibleHost *sender, VisibleHost *receiver) {
-        VisibleLink* inactiveLink = nullptr;
-        unsigned int visibleLinksCount = visibleLinks->size();
-
-        for (unsigned int i = 0; i < visibleLinksCount; i++) {
-            VisibleLink* link = visibleLinks->at(i);
-
-            if (link->getIsActive()) {
-                if (link->equals(sender, receiver)) {
-                    link->showLink(sender, receiver);
-                    return;
-                }
-            }
-            else if (inactiveLink == nullptr) {
-                inactiveLink = link;
-            }
-        }
+        forceLayout->addEdge(sender->getLayoutIndex(), receiver->getLayoutIndex());
 
-        if (inactiveLink != nullptr) {
-            inactiveLink->showLink(sender, receiver);
-        }
-    }
-
-    void NetView::setBufferPacketStates() {
-        unsigned int packetBufferSize = visiblePacketsBuffer->size();
-        for (unsigned int i = 0; i < packetBufferSize; i++) {
-            VisiblePacket* vp1 = visiblePacketsBuffer->at(i);
-
-            if (vp1->getToDelete()) {
-                continue;
-            }
-
-            for (unsigned int k = 0; k < packetBufferSize; k++) {
-                VisiblePacket* vp2 = visiblePacketsBuffer->at(k);
-
-                if (vp1 == vp2 || vp2->getToDelete()) {
-                    continue;
-                }
-
-                if (vp1->equals(vp2)) {
-                    vp1->setEqualPacketsInBuffer(vp1->getEqualPacketsInBuffer() + 1);
-                    vp2->setToDelete(true);
-                }
-            }
-        }
+        visibleLinkPool->showLink(sender, receiver);
     }
 
     void NetView::updatePacketBuffer(quint64 dt) {
@@ -400,22 +453,12 @@ namespace Netvisix {
 
         if (packetBufferTimer >= 50) {
             mutex.lock();
-            setBufferPacketStates();
+            releasedConversations.clear();
+            packetParticles->releaseBuffer(releasedConversations);
 
-            for (auto it = visiblePacketsBuffer->begin(); it != visiblePacketsBuffer->end();) {
-                VisiblePacket* vp = (*it);
-                if (vp->getToDelete()) {
-                    delete *it;
-                    it = visiblePacketsBuffer->erase(it);
-                }
-                else {
-                    visiblePackets->push_back(vp);
-                    showLink(vp->getSender(), vp->getReceiver());
-                    ++it;
-                }
+            for (const std::pair<VisibleHost*, VisibleHost*>& conversation : releasedConversations) {
+                showLink(conversation.first, conversation.second);
             }
-
-            visiblePacketsBuffer->clear();
             mutex.unlock();
 
             packetBufferTimer = 0;
@@ -424,7 +467,11 @@ namespace Netvisix {
 
     void NetView::onUpdate(quint64 dt) {
         // handle resize event (host repositioning)
-        if (wasResized) {
+        if (forceLayoutEnabled) {
+            updateHostLayoutPositions();
+            wasResized = false;
+        }
+        else if (wasResized) {
             resizeEventTimer += dt;
             if (resizeEventTimer >= 500) {
                 updateHostPositions();
@@ -435,6 +482,13 @@ namespace Netvisix {
 
         handleHostInfoPopup(dt);
 
+        if (frameScheduler != nullptr && frameScheduler->getRenderQuality() != renderQuality) {
+            renderQuality = frameScheduler->getRenderQuality();
+            mutex.lock();
+            packetParticles->setMaxParticles(renderQuality == RenderQuality::Low ? PARTICLES_MAX_LOW_QUALITY : 0);
+            mutex.unlock();
+        }
+
         if (isPaused) {
             return;
         }
@@ -443,38 +497,27 @@ namespace Netvisix {
 
         mutex.lock();
         // visibleLinks
-        unsigned int visibleLinksCount = visibleLinks->size();
-        for (unsigned int i = 0; i < visibleLinksCount; i++) {
-            VisibleLink* link = visibleLinks->at(i);
-            if (link->getIsActive()) {
-                link->onVisibleUpdate(dt);
-            }
-        }
+        visibleLinkPool->update(dt);
 
         // visibleHosts
         unsigned int visibleHostsCount = visibleHosts->size();
         for (unsigned int i = 0; i < visibleHostsCount; i++) {
             VisibleHost* v = visibleHosts->at(i);
             v->onVisibleUpdate(dt);
+            hostPositionGrid->update(v, v->getPosition(), v->getRadius());
         }
 
-        for (auto it = visiblePackets->begin(); it != visiblePackets->end();) {
-            (*it)->onVisibleUpdate(dt);
-
-            if ((*it)->getToDelete()) {
-                delete *it;
-                it = visiblePackets->erase(it);
-            }
-            else {
-                ++it;
-            }
-        }
+        // packets
+        packetParticles->update(dt);
         mutex.unlock();
 
         update();
     }
 
     void NetView::paintEvent(QPaintEvent *event) {
+        QElapsedTimer paintTimer;
+        paintTimer.start();
+
         QPainter painter(this);
 
         Config::Theme* theme = Config::Settings::SharedInstance()->theme;
@@ -487,22 +530,12 @@ namespace Netvisix {
 
         mutex.lock();
         // visibleLinks
-        unsigned int visibleLinksCount = visibleLinks->size();
-        for (unsigned int i = 0; i < visibleLinksCount; i++) {
-            VisibleLink* link = visibleLinks->at(i);
-            if (link->getIsActive()) {
-                link->onVisiblePaint(painter);
-            }
-        }
+        visibleLinkPool->paint(painter);
 
         painter.setPen(theme->packetOutlineColor);
 
-        // visiblePackets
-        unsigned int visiblePacketsCount = visiblePackets->size();
-        for (unsigned int i = 0; i < visiblePacketsCount; i++) {
-            VisiblePacket* v = visiblePackets->at(i);
-             v->onVisiblePaint(painter);
-        }
+        // packets
+        packetParticles->paint(painter);
 
         painter.setPen(theme->hostOutlineColor);
 
@@ -513,6 +546,10 @@ namespace Netvisix {
             v->onVisiblePaint(painter);
         }
         mutex.unlock();
+
+        if (frameScheduler != nullptr) {
+            frameScheduler->addPaintTime(paintTimer.nsecsElapsed());
+        }
     }
 
 } // namespace Netvisix
@@ -21,9 +21,9 @@
 #define NETVIEW_H
 
 #include "Net/IPreparedNetEventListener.h"
+#include "Net/IHostRemovalListener.h"
 
 #include <QWidget>
-#include <QHostInfo>
 
 #include <mutex>
 
@@ -32,12 +32,16 @@ namespace Netvisix {
 
     class VisibleBase;
     class VisibleHost;
-    class VisiblePacket;
+    class PacketParticleSystem;
     enum class NetArea;
     class HostInfoPopup;
-    class VisibleLink;
+    class VisibleLinkPool;
+    class SpatialGrid;
+    class ForceLayout;
+    class FrameScheduler;
+    enum class RenderQuality;
 
-    class NetView : public QWidget, public IPreparedNetEventListener {
+    class NetView : public QWidget, public IPreparedNetEventListener, public IHostRemovalListener {
 
         public:
             NetView(QWidget *parent = 0);
@@ -57,26 +61,37 @@ namespace Netvisix {
 
             virtual void onHostAddrUpdate(Host* host) {}
 
+            virtual void onHostsRemoved(const std::vector<Host*>& hosts);
+            virtual void onHostsMerged(Host* host, const std::vector<Host*>& mergedHosts);
+
             static float getRandF() {
                 int r = rand() % 10000;
                 return (float) r / 10000;
             }
 
-            unsigned int getActivePacketsCount() { return this->visiblePackets->size(); }
+            unsigned int getActivePacketsCount();
             unsigned int getActiveHostsCount() { return this->visibleHosts->size(); }
 
+            size_t getMemoryUsage();
+
             bool getIsPaused() { return this->isPaused; }
             void setIsPaused(bool paused) { this->isPaused = paused; }
             void reset();
 
-            void setReverseDNSLookupEnabled(bool enabled);
-            bool getReverseDNSLookupEnabled() { return this->reverseDNSLookupEnabled; }
 
-        private slots:
-            void onReverseDNSLookupAnswer(QHostInfo hostInfo);
+            void setFrameScheduler(FrameScheduler* frameScheduler) { this->frameScheduler = frameScheduler; }
+            RenderQuality getRenderQuality();
+
+            void setForceLayoutEnabled(bool enabled);
+            bool getForceLayoutEnabled() { return this->forceLayoutEnabled; }
+
+            // packet colors by port based service instead of transport protocol
+            void setServiceColorsEnabled(bool enabled) { this->serviceColorsEnabled = enabled; }
+            bool getServiceColorsEnabled() { return this->serviceColorsEnabled; }
 
         protected:
             void mousePressEvent(QMouseEvent *event);
+            void mouseDoubleClickEvent(QMouseEvent *event);
 
             void paintEvent(QPaintEvent *event);
 
@@ -87,6 +102,9 @@ namespace Netvisix {
 
             void updateLanAreaRect();
             void updateHostPositions();
+            void updateHostLayoutPositions();
+
+            float getCollisionRadius(VisibleHost* vHost);
 
             VisibleHost* getHostAtPosition(QPointF pos, bool visibleOnly);
             void handleHostInfoPopup(quint64 dt);
@@ -94,17 +112,17 @@ namespace Netvisix {
             void showLink(VisibleHost* sender, VisibleHost* receiver);
 
             void updatePacketBuffer(quint64 dt);
-            void setBufferPacketStates();
-
-            void reverseDNSLookup(Host* host);
 
             std::vector<VisibleHost*>* visibleHosts;
-            std::vector<VisiblePacket*>* visiblePackets;
+            std::vector<VisibleHost*> visibleHostsByID;
 
-            std::vector<VisiblePacket*>* visiblePacketsBuffer;
+            SpatialGrid* hostTargetGrid;
+            SpatialGrid* hostPositionGrid;
+            PacketParticleSystem* packetParticles;
+            std::vector<std::pair<VisibleHost*, VisibleHost*>> releasedConversations;
             float packetBufferTimer;
 
-            std::vector<VisibleLink*>* visibleLinks;
+            VisibleLinkPool* visibleLinkPool;
 
             bool isPaused;
 
@@ -119,7 +137,16 @@ namespace Netvisix {
 
             HostInfoPopup* hostInfoPopup;
 
-            bool reverseDNSLookupEnabled;
+
+            const unsigned int PARTICLES_MAX_LOW_QUALITY = 2000;
+
+            ForceLayout* forceLayout;
+            bool forceLayoutEnabled;
+            bool serviceColorsEnabled;
+            std::vector<QPointF> layoutPositions;
+
+            FrameScheduler* frameScheduler;
+            RenderQuality renderQuality;
         };
 
 } // namespace Netvisix
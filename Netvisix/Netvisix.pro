@@ -14,6 +14,7 @@ QMAKE_CXXFLAGS += -std=c++11
 SOURCES += main.cpp\
     Config.cpp \
     GUI/HostList.cpp \
+    GUI/HostTableModel.cpp \
     GUI/MainWindow.cpp \
     GUI/StartCapturePopup.cpp \
     GUI/VisibleHost.cpp \
@@ -22,18 +23,38 @@ SOURCES += main.cpp\
     Net/NetEvent.cpp \
     Net/NetEventManager.cpp \
     Net/Host.cpp \
+    Net/PrefixTable.cpp \
+    Net/DNSCache.cpp \
+    Net/DNSParser.cpp \
+    Net/DHCPParser.cpp \
+    Net/TunnelParser.cpp \
+    Net/ServiceTable.cpp \
+    Net/PayloadInspector.cpp \
+    Net/BindingTable.cpp \
+    Net/IdentityResolver.cpp \
+    Net/GroupReportParser.cpp \
+    Net/MulticastGroupTable.cpp \
+    Net/PortSet.cpp \
+    Net/AnomalyDetector.cpp \
+    Net/ReverseDNSService.cpp \
+    Net/HostChangeTracker.cpp \
     Net/NetStatistic.cpp \
     Net/PacketHandler.cpp \
-    GUI/VisiblePacket.cpp \
+    GUI/PacketParticleSystem.cpp \
     GUI/StatusbarDisplay.cpp \
     Net/NetUtil.cpp \
     GUI/HostInfoPopup.cpp \
     GUI/VisibleLink.cpp \
-    GUI/StatisticPopup.cpp
+    GUI/StatisticPopup.cpp \
+    GUI/SpatialGrid.cpp \
+    GUI/ForceLayout.cpp \
+    GUI/FrameScheduler.cpp \
+    GUI/VisibleLinkPool.cpp
 
 HEADERS += GUI/MainWindow.h \
     Config.h \
     GUI/HostList.h \
+    GUI/HostTableModel.h \
     GUI/StartCapturePopup.h \
     GUI/VisibleHost.h \
     GUI/VisibleBase.h \
@@ -41,15 +62,36 @@ HEADERS += GUI/MainWindow.h \
     Net/NetEvent.h \
     Net/NetEventManager.h \
     Net/Host.h \
+    Net/PrefixTable.h \
+    Net/DNSCache.h \
+    Net/DNSParser.h \
+    Net/DHCPParser.h \
+    Net/TunnelParser.h \
+    Net/ServiceTable.h \
+    Net/PayloadInspector.h \
+    Net/BindingTable.h \
+    Net/IdentityResolver.h \
+    Net/GroupReportParser.h \
+    Net/MulticastGroupTable.h \
+    Net/PortSet.h \
+    Net/AddrKey.h \
+    Net/AnomalyDetector.h \
+    Net/ReverseDNSService.h \
+    Net/HostChangeTracker.h \
     Net/NetStatistic.h \
     Net/PacketHandler.h \
-    GUI/VisiblePacket.h \
+    GUI/PacketParticleSystem.h \
     Net/IPreparedNetEventListener.h \
+    Net/IHostRemovalListener.h \
     GUI/StatusbarDisplay.h \
     Net/NetUtil.h \
     GUI/HostInfoPopup.h \
     GUI/VisibleLink.h \
-    GUI/StatisticPopup.h
+    GUI/StatisticPopup.h \
+    GUI/SpatialGrid.h \
+    GUI/ForceLayout.h \
+    GUI/FrameScheduler.h \
+    GUI/VisibleLinkPool.h
 
 FORMS += MainWindow.ui \
     GUI/HostInfoPopup.ui \
@@ -0,0 +1,144 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Net/NetStatistic.h"
+#include "Net/NetEvent.h"
+#include "Net/ServiceTable.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Netvisix;
+
+
+// every counter of a statistic: protocol items, then service items (zero until the first service)
+static std::vector<unsigned long long> getCounters(NetStatistic* statistic) {
+    const IPVersion ipVersions[] = { IPVersion::ALL, IPVersion::ALL, IPVersion::ALL, IPVersion::IPV4, IPVersion::IPV4, IPVersion::IPV4,
+                                     IPVersion::IPV4, IPVersion::IPV4, IPVersion::IPV6, IPVersion::IPV6, IPVersion::IPV6, IPVersion::IPV6 };
+    const Protocol protocols[] = { Protocol::EthernetII, Protocol::Unkown, Protocol::OtherL2, Protocol::ARP, Protocol::ICMP, Protocol::TCP,
+                                   Protocol::UDP, Protocol::OtherL3, Protocol::ICMPv6, Protocol::TCP, Protocol::UDP, Protocol::OtherL3 };
+
+    std::vector<unsigned long long> counters;
+    for (unsigned int i = 0; i < sizeof(protocols) / sizeof(protocols[0]); i++) {
+        NetStatistic::Item* item = statistic->getItem(ipVersions[i], protocols[i]);
+        counters.insert(counters.end(), { item->framesSnt, item->framesRcv, item->bytesSnt, item->bytesRcv });
+    }
+    for (unsigned int i = 0; i < ServiceTable::SERVICE_COUNT; i++) {
+        NetStatistic::Item* item = statistic->getServiceItem((Service) i);
+        if (item != nullptr) {
+            counters.insert(counters.end(), { item->framesSnt, item->framesRcv, item->bytesSnt, item->bytesRcv });
+        }
+        else {
+            counters.insert(counters.end(), { 0, 0, 0, 0 });
+        }
+    }
+    return counters;
+}
+
+static std::vector<unsigned long long> getTotals(const std::vector<NetStatistic*>& statistics) {
+    std::vector<unsigned long long> totals;
+    for (NetStatistic* statistic : statistics) {
+        std::vector<unsigned long long> counters = getCounters(statistic);
+        totals.resize(counters.size(), 0);
+        for (unsigned int i = 0; i < counters.size(); i++) {
+            totals[i] += counters[i];
+        }
+    }
+    return totals;
+}
+
+static void addTraffic(NetStatistic* statistic, unsigned int seed) {
+    const Protocol l2Protocols[] = { Protocol::IPv4, Protocol::IPv6, Protocol::ARP, Protocol::OtherL2 };
+    const Protocol l3Protocols[] = { Protocol::TCP, Protocol::UDP, Protocol::ICMP, Protocol::OtherL3 };
+
+    std::srand(seed);
+    unsigned int frameCount = 1 + std::rand() % 200;
+    for (unsigned int i = 0; i < frameCount; i++) {
+        NetEvent ne;
+        ne.size = 60 + std::rand() % 1455;
+        ne.l1Protocol = Protocol::EthernetII;
+        ne.l2Protocol = l2Protocols[std::rand() % 4];
+        ne.l3Protocol = l3Protocols[std::rand() % 4];
+        ne.service = (std::rand() % 3 == 0) ? (Service) (1 + std::rand() % (ServiceTable::SERVICE_COUNT - 1)) : Service::None;
+        statistic->handleNetEvent((std::rand() % 2) ? TrafficDirection::TD_IN : TrafficDirection::TD_OUT, &ne);
+    }
+}
+
+static int failureCount = 0;
+
+static void check(bool condition, const char* description) {
+    std::cout << (condition ? "PASS  " : "FAIL  ") << description << std::endl;
+    if (! condition) {
+        failureCount++;
+    }
+}
+
+int main() {
+    // eviction: the evicted hosts are rolled up into the "other" statistic of their net area
+    std::vector<NetStatistic*> hosts;
+    for (unsigned int i = 0; i < 40; i++) {
+        hosts.push_back(new NetStatistic());
+        addTraffic(hosts.back(), i);
+    }
+    NetStatistic* otherSubnet = new NetStatistic();
+    NetStatistic* otherOutsideSubnet = new NetStatistic();
+    std::vector<unsigned long long> totals = getTotals(hosts);
+
+    std::vector<NetStatistic*> remaining;
+    for (unsigned int i = 0; i < hosts.size(); i++) {
+        if (i % 3 == 0) {
+            ((i % 2) ? otherSubnet : otherOutsideSubnet)->add(hosts[i]);
+            delete hosts[i];
+        }
+        else {
+            remaining.push_back(hosts[i]);
+        }
+    }
+    remaining.push_back(otherSubnet);
+    remaining.push_back(otherOutsideSubnet);
+    check(getTotals(remaining) == totals, "eviction keeps the totals");
+    check(getCounters(otherSubnet)[0] > 0 && getCounters(otherOutsideSubnet)[0] > 0, "both other statistics are counted");
+
+    // drill-down: the aggregate is split evenly over its member hosts
+    NetStatistic* aggregate = new NetStatistic();
+    addTraffic(aggregate, 1000);
+    for (unsigned int memberCount : { 1u, 3u, 7u, 256u }) {
+        std::vector<NetStatistic*> members;
+        for (unsigned int i = 0; i < memberCount; i++) {
+            members.push_back(new NetStatistic());
+            members.back()->add(aggregate, i, memberCount);
+        }
+        std::string description = "expansion into " + std::to_string(memberCount) + " members keeps the totals";
+        check(getTotals(members) == getCounters(aggregate), description.c_str());
+
+        for (NetStatistic* member : members) {
+            delete member;
+        }
+    }
+
+    for (NetStatistic* statistic : remaining) {
+        delete statistic;
+    }
+    delete aggregate;
+
+    std::cout << (failureCount == 0 ? "all passed" : "failures: " + std::to_string(failureCount)) << std::endl;
+    return (failureCount == 0) ? 0 : 1;
+}
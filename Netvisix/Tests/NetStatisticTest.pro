@@ -0,0 +1,35 @@
+#-------------------------------------------------
+#
+# NetStatistic roll-up of evicted and expanded hosts (qmake && make check)
+#
+#-------------------------------------------------
+
+QT += core
+QT -= gui
+
+TARGET = NetStatisticTest
+TEMPLATE = app
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+QMAKE_CXXFLAGS += -std=c++11
+
+INCLUDEPATH += ..
+
+SOURCES += NetStatisticTest.cpp \
+    ../Net/NetStatistic.cpp \
+    ../Net/NetEvent.cpp \
+    ../Net/NetUtil.cpp \
+    ../Net/ServiceTable.cpp
+
+HEADERS += ../Net/NetStatistic.h
+
+# linux
+unix:!macx: INCLUDEPATH += $$PWD/../../libtins/include
+unix:!macx: LIBS += -L$$PWD/../../libtins/ -ltins -lpcap
+
+# win
+win32: DEFINES += TINS_STATIC
+win32: DEFINES += WIN32_LEAN_AND_MEAN
+win32: INCLUDEPATH += $$PWD\..\..\libtins-win\include
+win32: LIBS += -L$$PWD\..\..\libtins-win -ltins -lwpcap -lws2_32 -liphlpapi
@@ -0,0 +1,165 @@
+/*
+ *  Copyright (C) 2026 Benjamin W. (bitbatzen@gmail.com)
+ *
+ *  This file is part of Netvisix.
+ *
+ *  Netvisix is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  Netvisix is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with Netvisix.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Net/ReverseDNSService.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace Netvisix;
+
+
+// stub resolver: 10.0.0.x has a name for even x, lookups of 10.0.1.x block (resolver timeout)
+static std::atomic<unsigned int> lookupCount(0);
+static std::atomic<bool> isBlockingReleased(false);
+
+static std::mutex resultsMutex;
+static std::map<std::string, std::string> results;
+
+static int failureCount = 0;
+
+static std::string stubResolver(const std::string& ipAddr) {
+    lookupCount++;
+    if (ipAddr.compare(0, 7, "10.0.1.") == 0) {
+        while (! isBlockingReleased) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return "";
+    }
+
+    int x = std::stoi(ipAddr.substr(ipAddr.rfind('.') + 1));
+    return (x % 2 == 0) ? "host" + std::to_string(x) + ".stub" : "";
+}
+
+static void onResult(const std::string& ipAddr, const std::string& hostname) {
+    resultsMutex.lock();
+    results[ipAddr] = hostname;
+    resultsMutex.unlock();
+}
+
+static std::string getResult(const std::string& ipAddr) {
+    std::lock_guard<std::mutex> lock(resultsMutex);
+    auto it = results.find(ipAddr);
+    return (it != results.end()) ? it->second : "";
+}
+
+static bool waitFor(bool (*condition)(), long long timeout) {
+    auto start = std::chrono::steady_clock::now();
+    while (! condition()) {
+        if (std::chrono::steady_clock::now() - start > std::chrono::milliseconds(timeout)) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+static long long getElapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void check(bool condition, const char* description) {
+    std::cout << (condition ? "PASS  " : "FAIL  ") << description << std::endl;
+    if (! condition) {
+        failureCount++;
+    }
+}
+
+int main() {
+    auto shutdownStart = std::chrono::steady_clock::now();
+    {
+        ReverseDNSService service(onResult);
+        service.setResolver(stubResolver);
+        service.setRateLimit(1000);
+
+        // queued, answered through the result handler, then cached
+        check(service.request("10.0.0.2") == "", "first request is queued");
+        check(waitFor([] { return getResult("10.0.0.2") == "host2.stub"; }, 2000), "answer reaches the result handler");
+        unsigned int lookups = lookupCount;
+        check(service.request("10.0.0.2") == "host2.stub", "second request is served from the cache");
+        check(lookupCount == lookups, "cached address is not looked up again");
+
+        // deduplicated queue
+        lookupCount = 0;
+        for (int i = 0; i < 50; i++) {
+            service.request("10.0.0.4");
+        }
+        check(waitFor([] { return getResult("10.0.0.4") == "host4.stub"; }, 2000), "duplicate requests are answered");
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        check(lookupCount == 1, "duplicate requests are looked up once");
+
+        // negative cache
+        lookupCount = 0;
+        service.request("10.0.0.3");
+        check(waitFor([] { return lookupCount == 1; }, 2000), "address without a name is looked up");
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        check(service.request("10.0.0.3") == "" && getResult("10.0.0.3") == "", "no name, no result");
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        check(lookupCount == 1, "negative result is cached");
+
+        // rate limit (shared by all workers)
+        service.setRateLimit(10);
+        lookupCount = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 10; i < 16; i += 2) {
+            service.request("10.0.0." + std::to_string(i));
+        }
+        check(waitFor([] { return getResult("10.0.0.14") != ""; }, 3000), "rate limited lookups complete");
+        check(getElapsed(start) >= 150, "lookups are spaced by the rate limit");
+
+        // (above 1000 per second the interval is below a millisecond)
+        service.setRateLimit(4000);
+        lookupCount = 0;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 800; i++) {
+            service.request("10.2." + std::to_string(i / 200) + "." + std::to_string(i % 200));
+        }
+        check(waitFor([] { return lookupCount == 800; }, 3000), "fast rate limited lookups complete");
+        check(getElapsed(start) >= 150, "lookups are spaced by a rate limit above 1000 per second");
+        service.setRateLimit(1000);
+
+        // blocked lookups hold neither a concurrency change nor the shutdown
+        lookupCount = 0;
+        for (int i = 0; i < 4; i++) {
+            service.request("10.0.1." + std::to_string(i));
+        }
+        check(waitFor([] { return lookupCount == 4; }, 2000), "blocking lookups are running");
+        start = std::chrono::steady_clock::now();
+        service.setConcurrency(2);
+        check(getElapsed(start) < 100, "concurrency change does not wait for running lookups");
+
+        service.request("10.0.0.20");
+        check(waitFor([] { return getResult("10.0.0.20") == "host20.stub"; }, 2000), "new workers serve while old ones block");
+
+        shutdownStart = std::chrono::steady_clock::now();
+    }
+    check(getElapsed(shutdownStart) < 100, "shutdown does not wait for blocked lookups");
+
+    // (the detached workers finish their lookup and leave)
+    isBlockingReleased = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    std::cout << (failureCount == 0 ? "all passed" : "failures: " + std::to_string(failureCount)) << std::endl;
+    return (failureCount == 0) ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+#-------------------------------------------------
+#
+# ReverseDNSService against a local stub resolver (qmake && make check)
+#
+#-------------------------------------------------
+
+QT += core network
+QT -= gui
+
+TARGET = ReverseDNSServiceTest
+TEMPLATE = app
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+QMAKE_CXXFLAGS += -std=c++11
+
+INCLUDEPATH += ..
+
+SOURCES += ReverseDNSServiceTest.cpp \
+    ../Net/ReverseDNSService.cpp
+
+HEADERS += ../Net/ReverseDNSService.h